@@ -0,0 +1,407 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Aggregate.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 00:50 CST
+ *
+ * @brief   Implements the aggregation queries over the @c number field of
+ *          a list.
+ *
+ * References:
+ *          Intel Intrinsics Guide (AVX2 and SSE2 integer instructions).
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 00:50 CST -- File created
+ *
+ * @note    A range [low, high] is tested with one unsigned compare,
+ *          number - low <= high - low, done as a signed compare after
+ *          flipping the sign bits. The lanes count the numbers outside
+ *          the range in 32 bits, which is enough for one block. The
+ *          histogram is counted in plain C, one array of counts per
+ *          thread.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <string.h>                           /* Used for memset() */
+#include <limits.h>                      /* Used for INT_MIN & INT_MAX */
+#include <glib.h>                  /* Used for the lists and the threads */
+#include "Aggregate.h"                                /* Function header */
+#include "Traverse.h"                  /* Used for the prefetching walk */
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+#include <immintrin.h>                     /* Used for the SIMD kernels */
+
+#if defined(__AVX2__)
+#define AGGREGATE_KERNEL "AVX2"
+#define LANES 8
+typedef __m256i     vector;
+#define VLOAD(p)      _mm256_loadu_si256((const __m256i *)(p))
+#define VSTORE(p, a)  _mm256_storeu_si256((__m256i *)(p), a)
+#define VSET(c)       _mm256_set1_epi32(c)
+#define VZERO()       _mm256_setzero_si256()
+#define VSUB(a, b)    _mm256_sub_epi32(a, b)
+#define VXOR(a, b)    _mm256_xor_si256(a, b)
+#define VGT(a, b)     _mm256_cmpgt_epi32(a, b)
+#define VMIN(a, b)    _mm256_min_epi32(a, b)
+#define VMAX(a, b)    _mm256_max_epi32(a, b)
+#define VADD64(a, b)  _mm256_add_epi64(a, b)
+#define VLOW64(a)     _mm256_cvtepi32_epi64(_mm256_castsi256_si128(a))
+#define VHIGH64(a)    _mm256_cvtepi32_epi64(_mm256_extracti128_si256(a, 1))
+#else
+#define AGGREGATE_KERNEL "SSE2"
+#define LANES 4
+typedef __m128i     vector;
+#define VLOAD(p)      _mm_loadu_si128((const __m128i *)(p))
+#define VSTORE(p, a)  _mm_storeu_si128((__m128i *)(p), a)
+#define VSET(c)       _mm_set1_epi32(c)
+#define VZERO()       _mm_setzero_si128()
+#define VSUB(a, b)    _mm_sub_epi32(a, b)
+#define VXOR(a, b)    _mm_xor_si128(a, b)
+#define VGT(a, b)     _mm_cmpgt_epi32(a, b)
+#define VADD64(a, b)  _mm_add_epi64(a, b)
+#define VLOW64(a)     _mm_unpacklo_epi32(a, _mm_srai_epi32(a, 31))
+#define VHIGH64(a)    _mm_unpackhi_epi32(a, _mm_srai_epi32(a, 31))
+
+/* SSE2 has no 32-bit minimum and maximum, select with a compare */
+static inline vector VMIN (vector a, vector b) {
+    vector greater = _mm_cmpgt_epi32(a, b);
+
+    return _mm_or_si128(_mm_and_si128(greater, b),
+                        _mm_andnot_si128(greater, a));
+}
+
+static inline vector VMAX (vector a, vector b) {
+    vector greater = _mm_cmpgt_epi32(a, b);
+
+    return _mm_or_si128(_mm_and_si128(greater, a),
+                        _mm_andnot_si128(greater, b));
+}
+#endif
+
+/* Add at most AGGREGATE_BLOCK numbers to a result */
+static void Reduce (const int *numbers, size_t count, int low, int high,
+                    aggregate *result_p) {
+    vector       sumLow = VZERO(), sumHigh = VZERO(), outside = VZERO();
+    vector       least = VSET(result_p->min), most = VSET(result_p->max);
+    vector       base = VSET(low), sign = VSET(INT_MIN);
+    vector       limit = VSET((int)((unsigned)high - (unsigned)low)
+                              ^ INT_MIN);
+    vector       x;
+    int          lanes[LANES];
+    long long    sums[LANES];
+    unsigned int offset;
+    size_t       i;
+    int          l;
+
+    for (i = 0; i + LANES <= count; i += LANES) {
+        x = VLOAD(numbers + i);
+        sumLow = VADD64(sumLow, VLOW64(x));
+        sumHigh = VADD64(sumHigh, VHIGH64(x));
+        least = VMIN(least, x);
+        most = VMAX(most, x);
+        outside = VSUB(outside, VGT(VXOR(VSUB(x, base), sign), limit));
+    }
+
+    VSTORE(sums, sumLow);
+    VSTORE(sums + LANES / 2, sumHigh);
+    for (l = 0; l < LANES; l++)
+        result_p->sum += sums[l];
+    VSTORE(lanes, least);
+    for (l = 0; l < LANES; l++)
+        if (lanes[l] < result_p->min)
+            result_p->min = lanes[l];
+    VSTORE(lanes, most);
+    for (l = 0; l < LANES; l++)
+        if (lanes[l] > result_p->max)
+            result_p->max = lanes[l];
+    VSTORE(lanes, outside);
+    result_p->inRange += i;
+    for (l = 0; l < LANES; l++)
+        result_p->inRange -= lanes[l];
+
+    for (; i < count; i++) {                       /* The last few ones */
+        result_p->sum += numbers[i];
+        if (numbers[i] < result_p->min)
+            result_p->min = numbers[i];
+        if (numbers[i] > result_p->max)
+            result_p->max = numbers[i];
+        offset = (unsigned)numbers[i] - (unsigned)low;
+        result_p->inRange += offset <= (unsigned)high - (unsigned)low;
+    }
+    result_p->count += count;
+}
+
+#else
+
+#define AGGREGATE_KERNEL "scalar"
+
+/* Add some numbers to a result */
+static void Reduce (const int *numbers, size_t count, int low, int high,
+                    aggregate *result_p) {
+    unsigned int span = (unsigned)high - (unsigned)low;
+    size_t       i;
+
+    for (i = 0; i < count; i++) {
+        result_p->sum += numbers[i];
+        if (numbers[i] < result_p->min)
+            result_p->min = numbers[i];
+        if (numbers[i] > result_p->max)
+            result_p->max = numbers[i];
+        result_p->inRange += (unsigned)numbers[i] - (unsigned)low <= span;
+    }
+    result_p->count += count;
+}
+
+#endif
+
+static void StartResult (aggregate *result_p) {
+    result_p->count = 0;
+    result_p->sum = 0;
+    result_p->min = INT_MAX;
+    result_p->max = INT_MIN;
+    result_p->inRange = 0;
+}
+
+static void AddResult (aggregate *result_p, const aggregate *part_p) {
+    result_p->count += part_p->count;
+    result_p->sum += part_p->sum;
+    result_p->inRange += part_p->inRange;
+    if (part_p->min < result_p->min)
+        result_p->min = part_p->min;
+    if (part_p->max > result_p->max)
+        result_p->max = part_p->max;
+}
+
+/* The block being filled by AggregateList() */
+typedef struct gather_{
+    int        numbers[AGGREGATE_BLOCK];
+    size_t     count;
+    int        low;
+    int        high;
+    aggregate *result;
+}gather;
+
+static void GatherNumber (void *gather_p, node_p item_p) {
+    gather *block_p = gather_p;
+
+    block_p->numbers[block_p->count++] = item_p->number;
+    if (block_p->count == AGGREGATE_BLOCK) {
+        Reduce(block_p->numbers, AGGREGATE_BLOCK, block_p->low,
+               block_p->high, block_p->result);
+        block_p->count = 0;
+    }
+}
+
+static void CopyNumber (void *next_pp, node_p item_p) {
+    *(*(int **)next_pp)++ = item_p->number;
+}
+
+/**
+ * @brief Aggregate the numbers of a list.
+ */
+int AggregateList (GList *myList_p, int low, int high, aggregate *result_p) {
+    gather block;
+
+    if (result_p == NULL)
+        return EXIT_FAILURE;
+    StartResult(result_p);
+    block.count = 0;
+    block.low = low;
+    block.high = high;
+    block.result = result_p;
+    ListReduce(myList_p, GatherNumber, &block);
+    Reduce(block.numbers, block.count, low, high, result_p);
+    if (high < low)
+        result_p->inRange = 0;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Copy the numbers of a list into a column.
+ */
+numberColumn * NewNumberColumn (GList *myList_p) {
+    numberColumn *column_p = malloc(sizeof(numberColumn));
+    int          *next;
+
+    if (column_p == NULL)
+        return NULL;
+    column_p->count = g_list_length(myList_p);
+    column_p->numbers = malloc((column_p->count + 1) * sizeof(int));
+    if (column_p->numbers == NULL) {
+        free(column_p);
+        return NULL;
+    }
+    next = column_p->numbers;
+    ListReduce(myList_p, CopyNumber, &next);
+    return column_p;
+}
+
+/**
+ * @brief De-allocate a column.
+ */
+void FreeNumberColumn (numberColumn *column_p) {
+    if (column_p == NULL)
+        return;
+    free(column_p->numbers);
+    free(column_p);
+}
+
+/* One range of a column reduced by one thread */
+typedef struct part_{
+    const int * numbers;
+    size_t      count;
+    int         low;
+    int         high;
+    int         width;                     /* Of the bins of a histogram */
+    int         bins;
+    long      * counts;                    /* Histogram of the range     */
+    aggregate   result;
+    GThread   * thread;
+}part;
+
+static gpointer AggregatePart (gpointer data) {
+    part   *part_p = data;
+    size_t  i, block;
+
+    StartResult(&part_p->result);
+    for (i = 0; i < part_p->count; i += block) {
+        block = part_p->count - i < AGGREGATE_BLOCK ? part_p->count - i
+                                                    : AGGREGATE_BLOCK;
+        Reduce(part_p->numbers + i, block, part_p->low, part_p->high,
+               &part_p->result);
+    }
+    return NULL;
+}
+
+static gpointer HistogramPart (gpointer data) {
+    part      *part_p = data;
+    long long  offset, span = (long long)part_p->width * part_p->bins;
+    int        shift = -1;
+    size_t     i;
+
+    if ((part_p->width & (part_p->width - 1)) == 0)         /* 2^shift */
+        shift = __builtin_ctz(part_p->width);
+    for (i = 0; i < part_p->count; i++) {
+        offset = (long long)part_p->numbers[i] - part_p->low;
+        if (offset < 0 || offset >= span)
+            continue;
+        part_p->counts[shift >= 0 ? offset >> shift
+                                  : offset / part_p->width]++;
+        part_p->result.count++;
+    }
+    return NULL;
+}
+
+/* Split a column in ranges, one per thread */
+static part * SplitColumn (const numberColumn *column_p, int threads,
+                           int *parts_p) {
+    part  *parts;
+    size_t per;
+    int    p;
+
+    if (threads <= 0)
+        threads = g_get_num_processors();
+    if (column_p->count / AGGREGATE_MINRANGE < (size_t)threads)
+        threads = column_p->count / AGGREGATE_MINRANGE;
+    if (threads < 1)
+        threads = 1;
+    parts = calloc(threads, sizeof(part));
+    if (parts == NULL)
+        return NULL;
+
+    /* Whole blocks for every range, the last one takes the remainder */
+    per = column_p->count / threads / AGGREGATE_BLOCK * AGGREGATE_BLOCK;
+    for (p = 0; p < threads; p++) {
+        parts[p].numbers = column_p->numbers + p * per;
+        parts[p].count = p == threads - 1 ? column_p->count - p * per : per;
+    }
+    *parts_p = threads;
+    return parts;
+}
+
+/* Run work on every range and wait for all of them */
+static void RunParts (part *parts, int threads, GThreadFunc work) {
+    int p;
+
+    for (p = 1; p < threads; p++)
+        parts[p].thread = g_thread_new("aggregate", work, &parts[p]);
+    work(&parts[0]);                        /* The caller does the first */
+    for (p = 1; p < threads; p++)
+        g_thread_join(parts[p].thread);
+}
+
+/**
+ * @brief Aggregate the numbers of a column with several threads.
+ */
+int AggregateColumn (const numberColumn *column_p, int low, int high,
+                     int threads, aggregate *result_p) {
+    part *parts;
+    int   p;
+
+    if (column_p == NULL || result_p == NULL)
+        return EXIT_FAILURE;
+    parts = SplitColumn(column_p, threads, &threads);
+    if (parts == NULL)
+        return EXIT_FAILURE;
+    for (p = 0; p < threads; p++) {
+        parts[p].low = low;
+        parts[p].high = high;
+    }
+    RunParts(parts, threads, AggregatePart);
+
+    StartResult(result_p);
+    for (p = 0; p < threads; p++)
+        AddResult(result_p, &parts[p].result);
+    if (high < low)
+        result_p->inRange = 0;
+    free(parts);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Count the numbers of a column in bins of the same width.
+ */
+long HistogramColumn (const numberColumn *column_p, int low, int width,
+                      int bins, long *counts_p, int threads) {
+    part *parts;
+    long  counted = 0;
+    int   p, b, ok = TRUE;
+
+    if (column_p == NULL || counts_p == NULL || width < 1 || bins < 1)
+        return -1;
+    parts = SplitColumn(column_p, threads, &threads);
+    if (parts == NULL)
+        return -1;
+    for (p = 0; p < threads; p++) {
+        parts[p].low = low;
+        parts[p].width = width;
+        parts[p].bins = bins;
+        parts[p].counts = p == 0 ? counts_p : calloc(bins, sizeof(long));
+        ok &= parts[p].counts != NULL;
+    }
+    memset(counts_p, 0, bins * sizeof(long));
+    if (ok)
+        RunParts(parts, threads, HistogramPart);
+
+    for (p = 0; p < threads; p++) {
+        for (b = 0; p > 0 && ok && b < bins; b++)
+            counts_p[b] += parts[p].counts[b];
+        counted += parts[p].result.count;
+        if (p > 0)
+            free(parts[p].counts);
+    }
+    free(parts);
+    return ok ? counted : -1;
+}
+
+/**
+ * @brief Name of the kernel compiled in.
+ */
+const char * AggregateKernel (void) {
+    return AGGREGATE_KERNEL;
+}
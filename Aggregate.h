@@ -0,0 +1,159 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Aggregate.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 00:50 CST
+ *
+ * @brief   Declares aggregation queries over the @c number field of a
+ *          list: count, sum, minimum, maximum, numbers in a range and
+ *          histograms. The numbers are copied into contiguous blocks, or
+ *          into a column kept by the caller, and reduced several at a time
+ *          with SIMD instructions.
+ *
+ * References:
+ *          P. Boncz, M. Zukowski and N. Nes, "MonetDB/X100:
+ *          Hyper-pipelining query execution", CIDR 2005 (vectorized
+ *          execution over columns).
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 00:50 CST -- File created
+ *
+ * @note    As in TokenScan.h the kernel is chosen when compiling: AVX2 if
+ *          @c __AVX2__ is defined, SSE2 on any other x86-64 and plain C
+ *          elsewhere. The results are the same with all of them. Sums are
+ *          64-bit, so they do not overflow for lists of fewer than 2^32
+ *          elements.
+ *
+ */
+
+#ifndef AGGREGATE_H
+#define AGGREGATE_H
+
+#include <stddef.h>
+#include <glib.h>
+#include "UserDefined.h"
+
+/** @def  AGGREGATE_BLOCK
+ * @brief Numbers copied from a list and reduced at a time.
+ */
+#define AGGREGATE_BLOCK 4096
+
+/** @def  AGGREGATE_MINRANGE
+ * @brief Fewest numbers reduced by each thread. Smaller columns are
+ * reduced by the calling thread alone.
+ */
+#define AGGREGATE_MINRANGE 65536
+
+/**
+ * @struct aggregate
+ *
+ * @brief Result of an aggregation.
+ */
+typedef struct aggregate_{
+    long      count;            /**< numbers aggregated                   */
+    long long sum;              /**< their sum                            */
+    int       min;              /**< smallest, @c G_MAXINT if count is 0  */
+    int       max;              /**< largest, @c G_MININT if count is 0   */
+    long      inRange;          /**< numbers from low to high, inclusive  */
+}aggregate;
+
+/**
+ * @struct numberColumn
+ *
+ * @brief The numbers of a list, in the same order, in one array.
+ */
+typedef struct numberColumn_{
+    int    * numbers;           /**< the numbers                          */
+    size_t   count;             /**< how many there are                   */
+}numberColumn;
+
+/**
+ *
+ * @brief Aggregate the numbers of a list.
+ *
+ * @b AggregateList() copies the numbers into a block of
+ * @c AGGREGATE_BLOCK at a time, walking the list with the prefetching
+ * traversal, and reduces every block with the SIMD kernel.
+ *
+ * @param  myList_p pointer to the list.
+ * @param  low first number of the range counted in @c inRange.
+ * @param  high last number of the range, a range with @p high < @p low
+ *         is empty.
+ * @param  result_p where the result is stored.
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if @p result_p is NULL.
+ *
+ * @code
+ *  AggregateList(theList_p, 0, 99, &result);
+ *  printf("%lld %ld\n", result.sum, result.inRange);
+ * @endcode
+ *
+ */
+int AggregateList (GList *myList_p, int low, int high, aggregate *result_p);
+
+/**
+ *
+ * @brief Copy the numbers of a list into a column.
+ *
+ * The column is not updated when the list changes, build it again.
+ *
+ * @return pointer to the column, or NULL if there is no memory.
+ *
+ */
+numberColumn * NewNumberColumn (GList *myList_p);
+
+/**
+ *
+ * @brief De-allocate a column.
+ *
+ */
+void FreeNumberColumn (numberColumn *column_p);
+
+/**
+ *
+ * @brief Aggregate the numbers of a column with several threads.
+ *
+ * @param  column_p pointer to the column.
+ * @param  low first number of the range counted in @c inRange.
+ * @param  high last number of the range.
+ * @param  threads maximum number of threads, the calling one included,
+ *         0 to use the number of processors. Each one reduces at least
+ *         @c AGGREGATE_MINRANGE numbers.
+ * @param  result_p where the result is stored.
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if an argument is NULL.
+ *
+ */
+int AggregateColumn (const numberColumn *column_p, int low, int high,
+                     int threads, aggregate *result_p);
+
+/**
+ *
+ * @brief Count the numbers of a column in bins of the same width.
+ *
+ * Bin @c i counts the numbers from @p low + @c i * @p width to
+ * @p low + (@c i + 1) * @p width - 1. Numbers outside every bin are not
+ * counted.
+ *
+ * @param  column_p pointer to the column.
+ * @param  low first number of the first bin.
+ * @param  width numbers in each bin, at least 1.
+ * @param  bins number of bins.
+ * @param  counts_p array of @p bins counts, where the result is stored.
+ * @param  threads as in AggregateColumn().
+ * @return numbers counted in some bin, or -1 if an argument is not valid
+ *         or there is no memory.
+ *
+ */
+long HistogramColumn (const numberColumn *column_p, int low, int width,
+                      int bins, long *counts_p, int threads);
+
+/**
+ *
+ * @brief Name of the kernel compiled in: "AVX2", "SSE2" or "scalar".
+ *
+ */
+const char * AggregateKernel (void);
+
+#endif
@@ -0,0 +1,192 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    AsyncList.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 21:45 CST
+ *
+ * @brief   Implements the background destruction and the parallel copy of
+ *          lists.
+ *
+ * References:
+ *          Uses the Glib thread and asynchronous queue functions.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 21:45 CST -- File created
+ *
+ * @note    The parallel copy needs one walk of the links to find where
+ *          each range starts. That walk only reads the links, the
+ *          allocation and copying of the data is what is divided among
+ *          the threads.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <glib.h>                   /* Used for the lists and the threads */
+#include "AsyncList.h"                                /* Function header */
+
+/* State of the reclaimer thread, shared by every caller */
+static GMutex        reclaimLock;                /* Protects the fields   */
+static GCond         reclaimDone;                /* Signals pending == 0  */
+static GAsyncQueue * reclaimQueue;               /* Lists to destroy      */
+static GThread     * reclaimer;
+static long          pending;
+
+static GList         stopMark;              /* Asks the reclaimer to end */
+
+static gpointer ReclaimerThread (gpointer data) {
+    GAsyncQueue *queue_p = data;
+    GList       *theList_p;
+
+    while ((theList_p = g_async_queue_pop(queue_p)) != &stopMark) {
+        DestroyList(theList_p);
+        g_list_free(theList_p);
+
+        g_mutex_lock(&reclaimLock);
+        if (--pending == 0)
+            g_cond_broadcast(&reclaimDone);
+        g_mutex_unlock(&reclaimLock);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Hand a list over to the reclaimer thread to be destroyed.
+ */
+int DestroyListAsync (GList * theList_p) {
+    if (theList_p == NULL)
+        return EXIT_FAILURE;
+
+    g_mutex_lock(&reclaimLock);
+    if (reclaimer == NULL) {
+        reclaimQueue = g_async_queue_new();
+        reclaimer = g_thread_new("reclaimer", ReclaimerThread, reclaimQueue);
+    }
+    pending++;
+    g_async_queue_push(reclaimQueue, theList_p);
+    g_mutex_unlock(&reclaimLock);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Number of lists handed over that have not been destroyed yet.
+ */
+long ReclaimerPending (void) {
+    long count;
+
+    g_mutex_lock(&reclaimLock);
+    count = pending;
+    g_mutex_unlock(&reclaimLock);
+    return count;
+}
+
+/**
+ * @brief Wait until every list handed over has been destroyed.
+ */
+void WaitReclaimer (void) {
+    g_mutex_lock(&reclaimLock);
+    while (pending > 0)
+        g_cond_wait(&reclaimDone, &reclaimLock);
+    g_mutex_unlock(&reclaimLock);
+}
+
+/**
+ * @brief Destroy the lists that are still pending and end the reclaimer
+ * thread.
+ */
+void StopReclaimer (void) {
+    GThread     *thread_p;
+    GAsyncQueue *queue_p;
+
+    /* A call to DestroyListAsync() after this point starts a new thread */
+    g_mutex_lock(&reclaimLock);
+    thread_p = reclaimer;
+    queue_p = reclaimQueue;
+    reclaimer = NULL;
+    reclaimQueue = NULL;
+    if (thread_p != NULL)
+        g_async_queue_push(queue_p, &stopMark);
+    g_mutex_unlock(&reclaimLock);
+
+    if (thread_p != NULL) {
+        g_thread_join(thread_p);
+        g_async_queue_unref(queue_p);
+    }
+}
+
+/* One range of the list copied by one thread */
+typedef struct copyRange_{
+    GList * first;                         /* First element to copy      */
+    long    count;                         /* Number of elements to copy */
+    GList * head;                          /* The copy                   */
+    GList * tail;
+    GThread*thread;
+}copyRange;
+
+static gpointer CopyRange (gpointer data) {
+    copyRange *range_p = data;
+    GList     *l = range_p->first;
+    node_p     item_p;
+    long       i;
+
+    range_p->head = NULL;
+    for (i = 0; i < range_p->count; i++, l = l->next) {
+        item_p = l->data;
+        range_p->head = g_list_prepend(range_p->head,
+                                       NewItem(item_p->number,
+                                               item_p->theString));
+    }
+    range_p->tail = range_p->head;           /* The last one once reversed */
+    range_p->head = g_list_reverse(range_p->head);
+    return NULL;
+}
+
+/**
+ * @brief Perform a deep copy of an input list with several threads.
+ */
+GList * CopyListParallel (GList * inputList, int threads) {
+    copyRange *ranges;
+    GList     *l, *theCopy = NULL, *tail = NULL;
+    long       length = g_list_length(inputList), i, per;
+    int        n, r;
+
+    if (threads <= 0)
+        threads = g_get_num_processors();
+    if (length / COPY_MINRANGE < threads)
+        threads = length / COPY_MINRANGE;
+    if (threads <= 1)
+        return CopyList(inputList);
+
+    ranges = malloc(threads * sizeof(copyRange));
+    if (ranges == NULL)
+        return CopyList(inputList);
+
+    /* Find where every range starts, the last one takes the remainder */
+    per = length / threads;
+    for (l = inputList, n = 0, i = 0; n < threads; l = l->next, i++)
+        if (i == n * per) {
+            ranges[n].first = l;
+            ranges[n].count = n == threads - 1 ? length - i : per;
+            n++;
+        }
+
+    for (r = 1; r < threads; r++)
+        ranges[r].thread = g_thread_new("copy", CopyRange, &ranges[r]);
+    CopyRange(&ranges[0]);                  /* The caller does the first */
+
+    for (r = 0; r < threads; r++) {
+        if (r > 0)
+            g_thread_join(ranges[r].thread);
+        if (tail == NULL) {
+            theCopy = ranges[r].head;
+        } else {
+            tail->next = ranges[r].head;                  /* Stitch them */
+            ranges[r].head->prev = tail;
+        }
+        tail = ranges[r].tail;
+    }
+    free(ranges);
+    return theCopy;
+}
@@ -0,0 +1,106 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    AsyncList.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 21:45 CST
+ *
+ * @brief   Declares list routines that keep bulk work off the caller's
+ *          thread: lists are destroyed by a background reclaimer thread
+ *          and copied by several threads at once.
+ *
+ * References:
+ *          Uses the Glib thread and asynchronous queue functions.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 21:45 CST -- File created
+ *
+ * @note    The reclaimer thread is started by the first call to
+ *          DestroyListAsync() and runs until StopReclaimer() is called.
+ *          Lists are freed in the order they were handed over.
+ *
+ */
+
+#ifndef ASYNCLIST_H
+#define ASYNCLIST_H
+
+#include <glib.h>
+#include "UserDefined.h"
+
+/** @def  COPY_MINRANGE
+ * @brief Fewest elements copied by each thread of CopyListParallel().
+ * Smaller lists are copied by the calling thread alone.
+ */
+#define COPY_MINRANGE 16384
+
+/**
+ *
+ * @brief Hand a list over to the reclaimer thread to be destroyed.
+ *
+ * @b DestroyListAsync() returns in constant time. The reclaimer thread
+ * later de-allocates every element with DestroyList() and then the links
+ * of the list, so the caller must not use @p theList_p, its links or its
+ * data afterwards.
+ *
+ * @param  theList_p is a pointer to the list.
+ * @return @c EXIT_SUCCESS if the list was handed over, @c EXIT_FAILURE if
+ *         it is NULL.
+ *
+ * @code
+ *   DestroyListAsync(theList_p);
+ *   theList_p = NULL;
+ * @endcode
+ *
+ */
+int DestroyListAsync (GList * theList_p);
+
+/**
+ *
+ * @brief Number of lists handed over that have not been destroyed yet.
+ *
+ */
+long ReclaimerPending (void);
+
+/**
+ *
+ * @brief Wait until every list handed over has been destroyed.
+ *
+ */
+void WaitReclaimer (void);
+
+/**
+ *
+ * @brief Destroy the lists that are still pending and end the reclaimer
+ * thread.
+ *
+ * @b StopReclaimer() is meant for the end of the program. A later call to
+ * DestroyListAsync() starts a new reclaimer thread.
+ *
+ */
+void StopReclaimer (void);
+
+/**
+ *
+ * @brief Perform a deep copy of an input list with several threads.
+ *
+ * @b CopyListParallel() splits @p inputList into consecutive ranges of at
+ * least @c COPY_MINRANGE elements. Every range is copied by its own thread
+ * with NewItem() and the copies are linked together in order, so the
+ * result is the same as that of CopyList().
+ *
+ * @param  inputList pointer to the list to be copied. It must not be
+ *         changed by other threads during the copy.
+ * @param  threads maximum number of threads, the calling one included.
+ *         If it is 0 the number of processors is used.
+ * @return pointer to the new list.
+ *
+ * @code
+ *  outputList_p = CopyListParallel(inputList_p, 0);
+ * @endcode
+ *
+ */
+GList * CopyListParallel (GList * inputList, int threads);
+
+#endif
@@ -0,0 +1,268 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    AsyncLoader.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 12:20 CST
+ *
+ * @brief   Implements the overlapped (reader thread) and the serial node
+ *          file loaders.
+ *
+ * References:
+ *          Uses the streaming parser in RecordStream.c and the Glib thread
+ *          and asynchronous queue functions.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 12:20 CST -- File created
+ *          Mon 19 Oct 2026 07:20 CST -- A read error fails the load instead
+ *                                       of ending the file early
+ *
+ * @note    The list is built with g_list_prepend() and reversed at the
+ *          end, so building it is linear in the number of records.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <stdio.h>                                /* Used for fprintf() */
+#include <string.h>                                  /* Used for memcpy */
+#include <errno.h>                                    /* Used for EINTR */
+#include <fcntl.h>                                     /* Used for open */
+#include <unistd.h>                      /* Used for pread, read & close */
+#include <glib.h>              /* Used for lists, threads and the queues */
+#include "AsyncLoader.h"                              /* Function header */
+#include "RecordStream.h"                    /* Used to parse the blocks */
+#include "UserDefined.h"                        /* Used to create items */
+
+typedef struct block_{
+    char  * data;                          /* ASYNC_BLOCKSIZE bytes      */
+    ssize_t length;                        /* Bytes read, <= 0 at the end */
+    size_t  used;                          /* Bytes already parsed       */
+}block;
+
+typedef struct loader_{
+    int           fd;                      /* File being read            */
+    GAsyncQueue * full;                    /* Blocks ready to be parsed  */
+    GAsyncQueue * empty;                   /* Blocks ready to be filled  */
+    block       * current;                 /* Block being parsed         */
+    int           done;                    /* Last block was seen        */
+    int           failed;                  /* A read returned an error   */
+    gint64        readTime;                /* Microseconds in pread      */
+    gint64        waitTime;                /* Microseconds waiting       */
+    size_t        bytes;                   /* Bytes read                 */
+}loader;
+
+/* Body of the reader thread */
+static gpointer ReaderThread (gpointer data) {
+    loader * loader_p = data;
+    block  * block_p;
+    off_t    offset = 0;
+    gint64   start;
+
+    do {
+        block_p = g_async_queue_pop(loader_p->empty);
+        start = g_get_monotonic_time();
+        do
+            block_p->length = pread(loader_p->fd, block_p->data,
+                                    ASYNC_BLOCKSIZE, offset);
+        while (block_p->length < 0 && errno == EINTR);
+        loader_p->readTime += g_get_monotonic_time() - start;
+        block_p->used = 0;
+        if (block_p->length > 0) {
+            offset += block_p->length;
+            loader_p->bytes += block_p->length;
+        }
+        g_async_queue_push(loader_p->full, block_p);
+    } while (block_p->length > 0);
+
+    return NULL;
+}
+
+/* recordFill function that takes the input from the filled blocks */
+static size_t BlockFill (void *source_p, char *buffer_p, size_t size) {
+    loader * loader_p = source_p;
+    block  * block_p = loader_p->current;
+    size_t   n;
+    gint64   start;
+
+    while (block_p == NULL || (ssize_t)block_p->used >= block_p->length) {
+        if (loader_p->done)
+            return 0;
+        if (block_p != NULL)
+            g_async_queue_push(loader_p->empty, block_p);
+
+        start = g_get_monotonic_time();
+        block_p = g_async_queue_pop(loader_p->full);
+        loader_p->waitTime += g_get_monotonic_time() - start;
+
+        loader_p->current = block_p;
+        if (block_p->length <= 0) {         /* End of file or read error */
+            loader_p->failed = block_p->length < 0;
+            loader_p->done = 1;
+            return 0;
+        }
+    }
+
+    n = block_p->length - block_p->used;
+    if (n > size)
+        n = size;
+    memcpy(buffer_p, block_p->data + block_p->used, n);
+    block_p->used += n;
+    return n;
+}
+
+/* Parse every record of a stream into a new list */
+static GList * BuildList (recordStream *stream_p, long *records_p) {
+    GList    * theList_p = NULL;
+    recordView record;
+
+    *records_p = 0;
+    while (NextRecord(stream_p, &record) != EOF) {
+        theList_p = g_list_prepend(theList_p,
+                                   NewItem(record.number,
+                                           (char *)record.theString));
+        (*records_p)++;
+    }
+    return g_list_reverse(theList_p);
+}
+
+/**
+ * @brief Load a node file into a new list overlapping I/O and parsing.
+ */
+GList * LoadListAsync (const char *fileName, loadTimes *times_p) {
+    loader         loader_s;
+    block          blocks[ASYNC_NUMBLOCKS];
+    recordStream * stream_p;
+    GThread      * reader_p;
+    GList        * theList_p = NULL;
+    gint64         start = g_get_monotonic_time();
+    long           records = 0;
+    char           scratch[BUFSIZ];
+    int            i, n;
+
+    loader_s.fd = open(fileName, O_RDONLY);
+    if (loader_s.fd < 0)
+        return NULL;
+    loader_s.full = g_async_queue_new();
+    loader_s.empty = g_async_queue_new();
+    loader_s.current = NULL;
+    loader_s.done = 0;
+    loader_s.failed = 0;
+    loader_s.readTime = loader_s.waitTime = 0;
+    loader_s.bytes = 0;
+
+    for (n = 0; n < ASYNC_NUMBLOCKS; n++) {
+        blocks[n].data = malloc(ASYNC_BLOCKSIZE);
+        if (blocks[n].data == NULL)
+            break;
+        g_async_queue_push(loader_s.empty, &blocks[n]);
+    }
+
+    stream_p = OpenRecordSource(BlockFill, &loader_s);
+    if (n > 0 && stream_p != NULL) {
+        reader_p = g_thread_new("reader", ReaderThread, &loader_s);
+        theList_p = BuildList(stream_p, &records);
+
+        /* Let the reader finish in case the parser stopped early */
+        while (BlockFill(&loader_s, scratch, sizeof(scratch)) > 0)
+            ;
+        g_thread_join(reader_p);
+    }
+
+    CloseRecordStream(stream_p);
+    for (i = 0; i < n; i++)
+        free(blocks[i].data);
+    g_async_queue_unref(loader_s.full);
+    g_async_queue_unref(loader_s.empty);
+    close(loader_s.fd);
+
+    if (loader_s.failed) {               /* The list would be truncated */
+        DestroyList(theList_p);
+        g_list_free(theList_p);
+        return NULL;
+    }
+    if (times_p != NULL) {
+        times_p->wall = (g_get_monotonic_time() - start) / 1e6;
+        times_p->read = loader_s.readTime / 1e6;
+        times_p->wait = loader_s.waitTime / 1e6;
+        times_p->parse = times_p->wall - times_p->wait;
+        times_p->records = records;
+        times_p->bytes = loader_s.bytes;
+    }
+    return theList_p;
+}
+
+/* recordFill function that reads the file directly, timing the reads */
+static size_t ReadFill (void *source_p, char *buffer_p, size_t size) {
+    loader * loader_p = source_p;
+    gint64   start = g_get_monotonic_time();
+    ssize_t  n;
+
+    do
+        n = read(loader_p->fd, buffer_p, size);
+    while (n < 0 && errno == EINTR);
+    loader_p->readTime += g_get_monotonic_time() - start;
+    if (n <= 0) {
+        loader_p->failed = n < 0;
+        return 0;
+    }
+    loader_p->bytes += n;
+    return n;
+}
+
+/**
+ * @brief Load a node file into a new list reading and parsing in turns.
+ */
+GList * LoadListSerial (const char *fileName, loadTimes *times_p) {
+    loader         loader_s;
+    recordStream * stream_p;
+    GList        * theList_p = NULL;
+    gint64         start = g_get_monotonic_time();
+    long           records = 0;
+
+    loader_s.fd = open(fileName, O_RDONLY);
+    if (loader_s.fd < 0)
+        return NULL;
+    loader_s.readTime = loader_s.waitTime = 0;
+    loader_s.bytes = 0;
+    loader_s.failed = 0;
+
+    stream_p = OpenRecordSource(ReadFill, &loader_s);
+    if (stream_p != NULL)
+        theList_p = BuildList(stream_p, &records);
+    CloseRecordStream(stream_p);
+    close(loader_s.fd);
+
+    if (loader_s.failed) {               /* The list would be truncated */
+        DestroyList(theList_p);
+        g_list_free(theList_p);
+        return NULL;
+    }
+
+    if (times_p != NULL) {
+        times_p->wall = (g_get_monotonic_time() - start) / 1e6;
+        times_p->read = loader_s.readTime / 1e6;
+        times_p->wait = times_p->read;
+        times_p->parse = times_p->wall - times_p->read;
+        times_p->records = records;
+        times_p->bytes = loader_s.bytes;
+    }
+    return theList_p;
+}
+
+/**
+ * @brief Print the timings of a load.
+ */
+int PrintLoadTimes (const loadTimes *times_p, FILE *out) {
+    if (times_p == NULL)
+        return EXIT_FAILURE;
+
+    fprintf(out, "Loaded %ld records (%zu bytes)\n", times_p->records,
+            times_p->bytes);
+    fprintf(out, "  read %.6f s, parse %.6f s, waiting %.6f s\n",
+            times_p->read, times_p->parse, times_p->wait);
+    fprintf(out, "  serial estimate %.6f s, elapsed %.6f s\n",
+            times_p->read + times_p->parse, times_p->wall);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,112 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    AsyncLoader.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 12:20 CST
+ *
+ * @brief   Loads a node file into a list while a dedicated reader thread
+ *          reads the next blocks of the file, so the I/O overlaps with the
+ *          parsing and the list building.
+ *
+ * References:
+ *          Uses the streaming parser in RecordStream.c and the Glib thread
+ *          and asynchronous queue functions.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 12:20 CST -- File created
+ *          Mon 19 Oct 2026 07:20 CST -- A read error fails the load
+ *
+ * @note    The reader thread fills @c ASYNC_NUMBLOCKS blocks of
+ *          @c ASYNC_BLOCKSIZE bytes (triple buffering). Filled blocks are
+ *          handed to the caller's thread through a queue and returned to
+ *          the reader through a second one, so at most @c ASYNC_NUMBLOCKS
+ *          blocks are ever in flight.
+ *
+ */
+
+#ifndef ASYNCLOADER_H
+#define ASYNCLOADER_H
+
+#include <stdio.h>
+#include <glib.h>
+
+/** @def  ASYNC_BLOCKSIZE
+ * @brief Size in bytes of each block read by the reader thread.
+ */
+#define ASYNC_BLOCKSIZE (1 << 20)
+
+/** @def  ASYNC_NUMBLOCKS
+ * @brief Number of blocks shared by the reader and the parser.
+ */
+#define ASYNC_NUMBLOCKS 3
+
+/**
+ * @struct loadTimes
+ *
+ * @brief Timings of a load, all in seconds.
+ *
+ * For an overlapped load @c read + @c parse is the time a serial load
+ * would take and @c wall is the time it actually took.
+ */
+typedef struct loadTimes_{
+    double read;                  /**< time spent reading the file      */
+    double parse;                 /**< time spent parsing & list building */
+    double wait;                  /**< time the parser waited for blocks */
+    double wall;                  /**< elapsed time of the whole load    */
+    long   records;               /**< number of records loaded          */
+    size_t bytes;                 /**< number of bytes read              */
+}loadTimes;
+
+/**
+ *
+ * @brief Load a node file into a new list overlapping I/O and parsing.
+ *
+ * @b LoadListAsync starts a reader thread that reads the file with
+ * @c pread while the calling thread parses the blocks and builds the list
+ * with NewItem().
+ *
+ * @param  fileName is the path of the node file.
+ * @param  times_p is where the timings are stored, it may be NULL. It is
+ *         not changed if the file could not be opened or read.
+ * @return pointer to the new list, NULL if the file could not be opened,
+ *         a read failed or it has no records.
+ *
+ * @code
+ *  theList_p = LoadListAsync("nodes.txt", &times);
+ *  PrintLoadTimes(&times, stdout);
+ * @endcode
+ *
+ */
+GList * LoadListAsync (const char *fileName, loadTimes *times_p);
+
+/**
+ *
+ * @brief Load a node file into a new list reading and parsing in turns.
+ *
+ * @b LoadListSerial is the single-threaded reference for LoadListAsync().
+ *
+ * @param  fileName is the path of the node file.
+ * @param  times_p is where the timings are stored, it may be NULL. It is
+ *         not changed if the file could not be opened or read.
+ * @return pointer to the new list, NULL if the file could not be opened,
+ *         a read failed or it has no records.
+ *
+ */
+GList * LoadListSerial (const char *fileName, loadTimes *times_p);
+
+/**
+ *
+ * @brief Print the timings of a load.
+ *
+ * @param  times_p is a pointer to the timings of a load.
+ * @param  out is the stream where the timings are printed.
+ * @return @c EXIT_SUCCESS if the timings were printed, otherwise
+ *         @c EXIT_FAILURE.
+ *
+ */
+int PrintLoadTimes (const loadTimes *times_p, FILE *out);
+
+#endif
@@ -0,0 +1,274 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    BloomFilter.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 17:00 CST
+ *
+ * @brief   Implements a list with an attached Bloom filter over the
+ *          @c number and @c theString fields of its items.
+ *
+ * References:
+ *          A. Kirsch and M. Mitzenmacher, "Less hashing, same performance:
+ *          building a better Bloom filter", ESA 2006 (double hashing).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 17:00 CST -- File created
+ *          Mon 19 Oct 2026 04:00 CST -- Set the bits of an item before
+ *                                       growing the filter
+ *
+ * @note    Numbers and strings share one filter sized for two values per
+ *          item; they are hashed with different seeds. Link with @c -lm.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <stdio.h>                                /* Used for fprintf() */
+#include <math.h>                          /* Used for log() and exp() */
+#include <glib.h>                        /* Used for the list functions */
+#include "BloomFilter.h"                              /* Function header */
+
+/** @def  BLOOM_MINCAPACITY
+ * @brief Smallest number of items a filter is sized for.
+ */
+#define BLOOM_MINCAPACITY 64
+
+/* Final mixing step of splitmix64 */
+static guint64 Mix (guint64 x) {
+    x ^= x >> 30;
+    x *= 0xbf58476d1ce4e5b9ULL;
+    x ^= x >> 27;
+    x *= 0x94d049bb133111ebULL;
+    return x ^ (x >> 31);
+}
+
+static guint64 HashNumber (int number) {
+    return Mix((guint64)(unsigned int)number ^ 0x9e3779b97f4a7c15ULL);
+}
+
+/* 64-bit FNV-1a */
+static guint64 HashString (const char *string) {
+    guint64 hash = 0xcbf29ce484222325ULL;
+
+    while (*string != '\0') {
+        hash ^= (unsigned char)*string++;
+        hash *= 0x100000001b3ULL;
+    }
+    return Mix(hash);
+}
+
+/* Set (or test, if set is FALSE) the bits of one hashed value */
+static int Probe (bloomList *bloom_p, guint64 hash, int set) {
+    guint64 h2 = Mix(hash) | 1;
+    guint64 bit;
+    int     i;
+
+    for (i = 0; i < bloom_p->numHashes; i++) {
+        bit = (hash + i * h2) % bloom_p->numBits;
+        if (set)
+            bloom_p->bits[bit / 64] |= 1ULL << (bit % 64);
+        else if (!(bloom_p->bits[bit / 64] & (1ULL << (bit % 64))))
+            return FALSE;
+    }
+    return TRUE;
+}
+
+static void AddItem (bloomList *bloom_p, node_p item_p) {
+    Probe(bloom_p, HashNumber(item_p->number), TRUE);
+    Probe(bloom_p, HashString(item_p->theString), TRUE);
+}
+
+/* Allocate bits for capacity items, leaving the old filter if it fails */
+static int Size (bloomList *bloom_p, size_t capacity) {
+    double   ln2 = log(2.0);
+    size_t   values, numBits;
+    guint64 *bits;
+
+    if (capacity < BLOOM_MINCAPACITY)
+        capacity = BLOOM_MINCAPACITY;
+    values = 2 * capacity;
+    numBits = (size_t)ceil(-(double)values * log(bloom_p->rate)
+                           / (ln2 * ln2));
+    numBits = (numBits + 63) / 64 * 64;
+    bits = calloc(numBits / 64, sizeof(guint64));
+    if (bits == NULL)
+        return EXIT_FAILURE;
+
+    free(bloom_p->bits);
+    bloom_p->bits = bits;
+    bloom_p->numBits = numBits;
+    bloom_p->numHashes = (int)lround((double)numBits / values * ln2);
+    if (bloom_p->numHashes < 1)
+        bloom_p->numHashes = 1;
+    bloom_p->capacity = capacity;
+    return EXIT_SUCCESS;
+}
+
+/*
+ * Account for an inserted item, growing the filter when it is full. The
+ * bits are set first, so the item is found even if the filter can't grow.
+ */
+static int Inserted (bloomList *bloom_p, node_p item_p) {
+    AddItem(bloom_p, item_p);
+    bloom_p->inserted++;
+    if (bloom_p->inserted > bloom_p->capacity)
+        return BloomRebuild(bloom_p);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Attach a Bloom filter to a list.
+ */
+bloomList * NewBloomList (GList * myList_p, size_t expected, double rate) {
+    bloomList *bloom_p;
+    GList     *l;
+
+    if (!(rate > 0.0 && rate < 1.0))
+        return NULL;
+    bloom_p = calloc(1, sizeof(bloomList));
+    if (bloom_p == NULL)
+        return NULL;
+    bloom_p->list = myList_p;
+    bloom_p->rate = rate;
+    if (expected == 0)
+        expected = g_list_length(myList_p);
+
+    if (Size(bloom_p, expected) != EXIT_SUCCESS) {
+        free(bloom_p);
+        return NULL;
+    }
+    for (l = myList_p; l != NULL; l = l->next) {
+        AddItem(bloom_p, l->data);
+        bloom_p->inserted++;
+    }
+    return bloom_p;
+}
+
+/**
+ * @brief De-allocate the filter and return the list.
+ */
+GList * FreeBloomList (bloomList *bloom_p) {
+    GList *theList_p;
+
+    if (bloom_p == NULL)
+        return NULL;
+    theList_p = bloom_p->list;
+    free(bloom_p->bits);
+    free(bloom_p);
+    return theList_p;
+}
+
+/**
+ * @brief Insert an item at the end of the list.
+ */
+int BloomAppend (bloomList *bloom_p, node_p item_p) {
+    return BloomInsertBefore(bloom_p, NULL, item_p);
+}
+
+/**
+ * @brief Insert an item at the start of the list.
+ */
+int BloomPrepend (bloomList *bloom_p, node_p item_p) {
+    if (item_p == NULL)
+        return EXIT_FAILURE;
+    bloom_p->list = g_list_prepend(bloom_p->list, item_p);
+    return Inserted(bloom_p, item_p);
+}
+
+/**
+ * @brief Insert an item before an element of the list.
+ */
+int BloomInsertBefore (bloomList *bloom_p, GList *sibling_p, node_p item_p) {
+    if (item_p == NULL)
+        return EXIT_FAILURE;
+    bloom_p->list = g_list_insert_before(bloom_p->list, sibling_p, item_p);
+    return Inserted(bloom_p, item_p);
+}
+
+/**
+ * @brief Remove an element, which also frees its data.
+ */
+int BloomRemove (bloomList *bloom_p, GList *link_p) {
+    if (link_p == NULL)
+        return EXIT_FAILURE;
+    bloom_p->list = RemoveFromList(bloom_p->list, link_p);
+    bloom_p->removed++;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Rebuild the filter from the current contents of the list.
+ */
+int BloomRebuild (bloomList *bloom_p) {
+    size_t length = g_list_length(bloom_p->list);
+    GList *l;
+
+    if (Size(bloom_p, 2 * length) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+    for (l = bloom_p->list; l != NULL; l = l->next)
+        AddItem(bloom_p, l->data);
+    bloom_p->inserted = length;
+    bloom_p->removed = 0;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Find a value in the list, checking the filter first.
+ */
+GList * BloomFind (bloomList *bloom_p, const void *value_p, int key) {
+    GList  *found;
+    guint64 hash;
+
+    switch (key) {
+        case INT:       hash = HashNumber(((node_p)value_p)->number); break;
+        case SINGLEINT: hash = HashNumber(*(const int *)value_p); break;
+        case STR:       hash = HashString(((node_p)value_p)->theString);
+                        break;
+        case SINGLESTR: hash = HashString((const char *)value_p); break;
+        default:        return FindInList(bloom_p->list, value_p, key);
+    }
+
+    bloom_p->lookups++;
+    if (!Probe(bloom_p, hash, FALSE)) {
+        bloom_p->rejected++;                     /* Definitely a miss */
+        return NULL;
+    }
+    found = FindInList(bloom_p->list, value_p, key);
+    if (found == NULL)
+        bloom_p->falsePositives++;
+    return found;
+}
+
+/**
+ * @brief Estimated false positive rate for the current contents.
+ */
+double BloomExpectedRate (const bloomList *bloom_p) {
+    double values = 2.0 * bloom_p->inserted;      /* Removed ones included */
+
+    return pow(1.0 - exp(-bloom_p->numHashes * values / bloom_p->numBits),
+               bloom_p->numHashes);
+}
+
+/**
+ * @brief Print the size of the filter and its false positive rates.
+ */
+int PrintBloomStats (const bloomList *bloom_p, FILE *out) {
+    long misses;
+
+    if (bloom_p == NULL)
+        return EXIT_FAILURE;
+    misses = bloom_p->rejected + bloom_p->falsePositives;
+
+    fprintf(out, "Bloom filter: %zu bits, %d hashes, sized for %zu items\n",
+            bloom_p->numBits, bloom_p->numHashes, bloom_p->capacity);
+    fprintf(out, "  items added %zu, removed since the last rebuild %zu\n",
+            bloom_p->inserted, bloom_p->removed);
+    fprintf(out, "  false positive rate: requested %.4f expected %.4f"
+            " observed %.4f\n", bloom_p->rate, BloomExpectedRate(bloom_p),
+            misses > 0 ? (double)bloom_p->falsePositives / misses : 0.0);
+    fprintf(out, "  lookups %ld, answered by the filter %ld\n",
+            bloom_p->lookups, bloom_p->rejected);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,179 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    BloomFilter.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 17:00 CST
+ *
+ * @brief   Declares a list with an attached Bloom filter over the
+ *          @c number and @c theString fields of its items, so searches
+ *          for values that are not in the list return without a scan.
+ *
+ * References:
+ *          B. H. Bloom, "Space/time trade-offs in hash coding with
+ *          allowable errors", CACM 13(7), 1970.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 17:00 CST -- File created
+ *
+ * @warning The filter only learns about items inserted with the functions
+ *          in this file. After inserting in @c list directly call
+ *          BloomRebuild(), otherwise those items may not be found.
+ *
+ * @note    Removing items does not clear bits, it only makes the filter
+ *          less selective. BloomRebuild() restores it.
+ *
+ */
+
+#ifndef BLOOMFILTER_H
+#define BLOOMFILTER_H
+
+#include <stdio.h>
+#include <glib.h>
+#include "UserDefined.h"
+
+/**
+ * @struct bloomList
+ *
+ * @brief A list together with its Bloom filter and lookup statistics.
+ */
+typedef struct bloomList_{
+    GList  * list;              /**< the list, may be read directly       */
+    guint64* bits;              /**< the filter                           */
+    size_t   numBits;           /**< size of the filter in bits           */
+    int      numHashes;         /**< bits set per value                   */
+    double   rate;              /**< requested false positive rate        */
+    size_t   capacity;          /**< items the filter was sized for       */
+    size_t   inserted;          /**< items added since the last rebuild   */
+    size_t   removed;           /**< items removed since the last rebuild */
+    long     lookups;           /**< searches made with BloomFind()       */
+    long     rejected;          /**< searches answered by the filter      */
+    long     falsePositives;    /**< filter hits that were not in the list */
+}bloomList;
+
+/**
+ *
+ * @brief Attach a Bloom filter to a list.
+ *
+ * @param  myList_p pointer to the list, it may be NULL.
+ * @param  expected number of items the filter is sized for, or 0 to use
+ *         the length of the list. The filter grows by itself when more
+ *         items are inserted.
+ * @param  rate false positive rate, between 0 and 1 (e.g. 0.01).
+ * @return pointer to the new structure or NULL if there is no memory or
+ *         @p rate is not valid.
+ *
+ * @code
+ *  bloom_p = NewBloomList(theList_p, 0, 0.01);
+ *  item_p = BloomFind(bloom_p, "Donald", SINGLESTR);
+ * @endcode
+ *
+ */
+bloomList * NewBloomList (GList * myList_p, size_t expected, double rate);
+
+/**
+ *
+ * @brief De-allocate the filter and return the list, which is not
+ * modified.
+ *
+ */
+GList * FreeBloomList (bloomList *bloom_p);
+
+/**
+ *
+ * @brief Insert an item at the end of the list.
+ *
+ * @return @c EXIT_SUCCESS if the item was inserted. @c EXIT_FAILURE if
+ *         @p item_p is NULL, or if the item was inserted but the filter
+ *         could not grow for lack of memory: it is still found, the
+ *         filter is only less selective.
+ *
+ */
+int BloomAppend (bloomList *bloom_p, node_p item_p);
+
+/**
+ *
+ * @brief Insert an item at the start of the list.
+ *
+ * @return @c EXIT_SUCCESS if the item was inserted. @c EXIT_FAILURE if
+ *         @p item_p is NULL, or if the item was inserted but the filter
+ *         could not grow for lack of memory: it is still found, the
+ *         filter is only less selective.
+ *
+ */
+int BloomPrepend (bloomList *bloom_p, node_p item_p);
+
+/**
+ *
+ * @brief Insert an item before an element of the list, or at its end if
+ * @p sibling_p is NULL.
+ *
+ * @return @c EXIT_SUCCESS if the item was inserted. @c EXIT_FAILURE if
+ *         @p item_p is NULL, or if the item was inserted but the filter
+ *         could not grow for lack of memory: it is still found, the
+ *         filter is only less selective.
+ *
+ */
+int BloomInsertBefore (bloomList *bloom_p, GList *sibling_p, node_p item_p);
+
+/**
+ *
+ * @brief Remove an element with RemoveFromList(), which also frees its
+ * data.
+ *
+ * @return @c EXIT_SUCCESS if the element was removed, otherwise
+ *         @c EXIT_FAILURE.
+ *
+ */
+int BloomRemove (bloomList *bloom_p, GList *link_p);
+
+/**
+ *
+ * @brief Rebuild the filter from the current contents of the list.
+ *
+ * @b BloomRebuild() sizes the filter again for the current length of the
+ * list and clears the bits left by removed items.
+ *
+ * @return @c EXIT_SUCCESS if the filter was rebuilt, @c EXIT_FAILURE if
+ *         there is no memory (the old filter is kept).
+ *
+ */
+int BloomRebuild (bloomList *bloom_p);
+
+/**
+ *
+ * @brief Find a value in the list, checking the filter first.
+ *
+ * @b BloomFind() has the same arguments and result as FindInList(). If the
+ * filter says the value is not in the list NULL is returned right away,
+ * otherwise the list is scanned.
+ *
+ * @param  bloom_p pointer to the list with its filter.
+ * @param  value_p pointer to the user-defined data value to match.
+ * @param  key which field to match, as in FindInList().
+ * @return pointer to the element that matches or NULL.
+ *
+ */
+GList * BloomFind (bloomList *bloom_p, const void *value_p, int key);
+
+/**
+ *
+ * @brief Estimated false positive rate for the current contents of the
+ * filter.
+ *
+ */
+double BloomExpectedRate (const bloomList *bloom_p);
+
+/**
+ *
+ * @brief Print the size of the filter and the requested, expected and
+ * observed false positive rates.
+ *
+ * @return @c EXIT_SUCCESS if it was printed, otherwise @c EXIT_FAILURE.
+ *
+ */
+int PrintBloomStats (const bloomList *bloom_p, FILE *out);
+
+#endif
@@ -0,0 +1,403 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    CompactList.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 20:10 CST
+ *
+ * @brief   Implements the compact, read-only copy of a sorted list.
+ *
+ * References:
+ *          I. H. Witten, A. Moffat and T. C. Bell, "Managing Gigabytes",
+ *          2nd ed., 1999 (front coding and variable-byte codes).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 20:10 CST -- File created
+ *          Mon 19 Oct 2026 04:35 CST -- Free the moved buffer when the
+ *                                       finder can't be allocated
+ *          Mon 19 Oct 2026 06:35 CST -- A descent at the start of a block
+ *                                       is also rejected as not sorted
+ *
+ * @note    Every record is stored as four fields: the difference with the
+ *          previous number, the length of the prefix shared with the
+ *          previous string, the length of the rest of the string and the
+ *          rest of the string. The first three are unsigned integers of 7
+ *          bits per byte, the high bit set in all but the last byte. The
+ *          first record of a block is coded against its number in the
+ *          index and an empty string, so decoding can start at any block.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <stdio.h>                                  /* Used for printf() */
+#include <string.h>                       /* Used for memcpy & strlen */
+#include <glib.h>                        /* Used for the list functions */
+#include "CompactList.h"                              /* Function header */
+
+/* First number and position of each block */
+typedef struct compactBlock_{
+    int    first;
+    size_t offset;
+}compactBlock;
+
+struct compactList_{
+    unsigned char * data;                  /* Coded records              */
+    size_t          size;                  /* Bytes used in data         */
+    compactBlock  * blocks;                /* Index of the blocks        */
+    size_t          numBlocks;
+    size_t          length;                /* Number of records          */
+    size_t          maxString;             /* Longest string             */
+    compactIter   * finder;                /* Used by CompactFind()      */
+};
+
+struct compactIter_{
+    const compactList * compact_p;
+    size_t              block;             /* Block of the next record   */
+    size_t              index;             /* Its position in the block  */
+    size_t              offset;            /* Its position in data       */
+    int                 number;            /* Last number decoded        */
+    char              * string;            /* Last string decoded        */
+    size_t              length;            /* Length of string           */
+    int                 ready;             /* Decoded but not returned   */
+};
+
+/* Growable byte array used while coding */
+typedef struct byteArray_{
+    unsigned char * bytes;
+    size_t          size;
+    size_t          capacity;
+}byteArray;
+
+static int Reserve (byteArray *array_p, size_t more) {
+    unsigned char *bigger;
+    size_t         capacity = array_p->capacity ? array_p->capacity : 4096;
+
+    while (array_p->size + more > capacity)
+        capacity *= 2;
+    if (capacity != array_p->capacity) {
+        bigger = realloc(array_p->bytes, capacity);
+        if (bigger == NULL)
+            return EXIT_FAILURE;
+        array_p->bytes = bigger;
+        array_p->capacity = capacity;
+    }
+    return EXIT_SUCCESS;
+}
+
+/* Append an unsigned integer, 7 bits per byte; 5 bytes are reserved */
+static void PutVarint (byteArray *array_p, size_t value) {
+    while (value >= 0x80) {
+        array_p->bytes[array_p->size++] = (unsigned char)(value | 0x80);
+        value >>= 7;
+    }
+    array_p->bytes[array_p->size++] = (unsigned char)value;
+}
+
+static inline size_t GetVarint (const unsigned char **data_pp) {
+    const unsigned char *p = *data_pp;
+    size_t               value = 0;
+    int                  shift = 0;
+
+    while (*p & 0x80) {
+        value |= (size_t)(*p++ & 0x7F) << shift;
+        shift += 7;
+    }
+    value |= (size_t)*p++ << shift;
+    *data_pp = p;
+    return value;
+}
+
+static size_t SharedPrefix (const char *a, const char *b) {
+    size_t i = 0;
+
+    while (a[i] != '\0' && a[i] == b[i])
+        i++;
+    return i;
+}
+
+/**
+ * @brief Build a compact copy of a sorted list.
+ */
+compactList * NewCompactList (GList *myList_p) {
+    compactList *compact_p;
+    byteArray    array = {NULL, 0, 0};
+    GList       *l;
+    node_p       item_p;
+    const char  *previous = "";
+    int          number = 0;
+    size_t       i, prefix, length, numBlocks;
+
+    numBlocks = (g_list_length(myList_p) + COMPACT_BLOCKSIZE - 1)
+                / COMPACT_BLOCKSIZE;
+    compact_p = calloc(1, sizeof(compactList));
+    if (compact_p == NULL)
+        return NULL;
+    compact_p->blocks = malloc((numBlocks ? numBlocks : 1)
+                               * sizeof(compactBlock));
+    if (compact_p->blocks == NULL)
+        goto failed;
+
+    for (l = myList_p, i = 0; l != NULL; l = l->next, i++) {
+        item_p = l->data;
+        if (i > 0 && item_p->number < number)
+            goto failed;                               /* Not sorted */
+        if (i % COMPACT_BLOCKSIZE == 0) {        /* Start a new block */
+            compact_p->blocks[i / COMPACT_BLOCKSIZE].first = item_p->number;
+            compact_p->blocks[i / COMPACT_BLOCKSIZE].offset = array.size;
+            number = item_p->number;    /* Deltas restart at each block */
+            previous = "";
+        }
+
+        prefix = SharedPrefix(previous, item_p->theString);
+        length = strlen(item_p->theString);
+        if (Reserve(&array, 3 * 10 + length - prefix) != EXIT_SUCCESS)
+            goto failed;
+        PutVarint(&array, (unsigned int)item_p->number - (unsigned int)number);
+        PutVarint(&array, prefix);
+        PutVarint(&array, length - prefix);
+        memcpy(array.bytes + array.size, item_p->theString + prefix,
+               length - prefix);
+        array.size += length - prefix;
+
+        if (length > compact_p->maxString)
+            compact_p->maxString = length;
+        number = item_p->number;
+        previous = item_p->theString;
+    }
+
+    /* Give back the unused memory */
+    compact_p->data = array.size ? realloc(array.bytes, array.size) : NULL;
+    if (compact_p->data == NULL)
+        compact_p->data = array.bytes;
+    array.bytes = NULL;                       /* Now owned by compact_p */
+    compact_p->size = array.size;
+    compact_p->numBlocks = numBlocks;
+    compact_p->length = i;
+    compact_p->finder = NewCompactIter(compact_p);
+    if (compact_p->finder == NULL)
+        goto failed;
+    return compact_p;
+
+failed:
+    free(array.bytes);
+    free(compact_p->data);
+    free(compact_p->blocks);
+    free(compact_p);
+    return NULL;
+}
+
+/**
+ * @brief De-allocate a compact list.
+ */
+void FreeCompactList (compactList *compact_p) {
+    if (compact_p != NULL) {
+        FreeCompactIter(compact_p->finder);
+        free(compact_p->data);
+        free(compact_p->blocks);
+        free(compact_p);
+    }
+}
+
+/**
+ * @brief Number of records in a compact list.
+ */
+size_t CompactLength (const compactList *compact_p) {
+    return compact_p->length;
+}
+
+/**
+ * @brief Bytes of memory used by a compact list, including its index.
+ */
+size_t CompactBytes (const compactList *compact_p) {
+    return sizeof(compactList) + compact_p->size
+           + compact_p->numBlocks * sizeof(compactBlock)
+           + sizeof(compactIter) + compact_p->maxString + 1;
+}
+
+/**
+ * @brief Start reading a compact list from its first record.
+ */
+compactIter * NewCompactIter (const compactList *compact_p) {
+    compactIter *iter_p = calloc(1, sizeof(compactIter));
+
+    if (iter_p == NULL)
+        return NULL;
+    iter_p->string = malloc(compact_p->maxString + 1);
+    if (iter_p->string == NULL) {
+        free(iter_p);
+        return NULL;
+    }
+    iter_p->compact_p = compact_p;
+    iter_p->string[0] = '\0';
+    return iter_p;
+}
+
+/**
+ * @brief De-allocate an iterator.
+ */
+void FreeCompactIter (compactIter *iter_p) {
+    if (iter_p != NULL) {
+        free(iter_p->string);
+        free(iter_p);
+    }
+}
+
+/* Decode the record at the position of the iterator and move past it */
+static int Decode (compactIter *iter_p) {
+    const compactList   *compact_p = iter_p->compact_p;
+    const unsigned char *p;
+    size_t               prefix, suffix;
+
+    if (iter_p->block >= compact_p->numBlocks)
+        return EOF;
+    if (iter_p->index == 0) {
+        iter_p->offset = compact_p->blocks[iter_p->block].offset;
+        iter_p->number = compact_p->blocks[iter_p->block].first;
+    }
+
+    p = compact_p->data + iter_p->offset;
+    iter_p->number = (int)((unsigned int)iter_p->number + GetVarint(&p));
+    prefix = GetVarint(&p);
+    suffix = GetVarint(&p);
+    memcpy(iter_p->string + prefix, p, suffix);
+    iter_p->length = prefix + suffix;
+    iter_p->string[iter_p->length] = '\0';
+    iter_p->offset = p + suffix - compact_p->data;
+
+    if (++iter_p->index == COMPACT_BLOCKSIZE ||
+        iter_p->block * COMPACT_BLOCKSIZE + iter_p->index
+        == compact_p->length) {
+        iter_p->block++;
+        iter_p->index = 0;
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Read the next record.
+ */
+int CompactNext (compactIter *iter_p, recordView *record_p) {
+    if (!iter_p->ready && Decode(iter_p) == EOF)
+        return EOF;
+    iter_p->ready = FALSE;
+    record_p->number = iter_p->number;
+    record_p->theString = iter_p->string;
+    record_p->length = iter_p->length;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Move an iterator to the first record with a number equal to or
+ * greater than a value.
+ */
+void CompactSeek (compactIter *iter_p, int number) {
+    const compactList *compact_p = iter_p->compact_p;
+    size_t             lo = 0, hi = compact_p->numBlocks, mid;
+
+    /* Last block that starts below number, equal ones may be before it */
+    while (hi - lo > 1) {
+        mid = lo + (hi - lo) / 2;
+        if (compact_p->blocks[mid].first < number)
+            lo = mid;
+        else
+            hi = mid;
+    }
+    iter_p->block = lo;
+    iter_p->index = 0;
+    iter_p->ready = FALSE;
+    while (Decode(iter_p) == EXIT_SUCCESS)
+        if (iter_p->number >= number) {
+            iter_p->ready = TRUE;                /* Returned by CompactNext */
+            break;
+        }
+}
+
+/* Move an iterator back to the first record */
+static void Rewind (compactIter *iter_p) {
+    iter_p->block = iter_p->index = 0;
+    iter_p->ready = FALSE;
+}
+
+/**
+ * @brief Find the first record that matches a value.
+ */
+int CompactFind (compactList *compact_p, const void *value_p, int key,
+                 recordView *record_p) {
+    compactIter *iter_p = compact_p->finder;
+    int          number;
+
+    switch (key) {
+        case INT:
+        case SINGLEINT:
+            number = key == INT ? ((node_p)value_p)->number
+                                : *(const int *)value_p;
+            CompactSeek(iter_p, number);
+            if (CompactNext(iter_p, record_p) == EXIT_SUCCESS &&
+                record_p->number == number)
+                return EXIT_SUCCESS;
+            return EXIT_FAILURE;
+        default:
+            Rewind(iter_p);
+            while (CompactNext(iter_p, record_p) == EXIT_SUCCESS)
+                if (MatchRecord(record_p, value_p, key) == EQUAL)
+                    return EXIT_SUCCESS;
+            return EXIT_FAILURE;
+    }
+}
+
+/**
+ * @brief Call a visitor for every record of a compact list.
+ */
+long CompactRecords (const compactList *compact_p, recordVisitor visit,
+                     void *arg_p) {
+    compactIter *iter_p = NewCompactIter(compact_p);
+    recordView   record;
+    long         count = 0;
+
+    if (iter_p == NULL)
+        return 0;
+    while (CompactNext(iter_p, &record) == EXIT_SUCCESS) {
+        count++;
+        if (visit(&record, arg_p) != EXIT_SUCCESS)
+            break;
+    }
+    FreeCompactIter(iter_p);
+    return count;
+}
+
+static int PrintRecord (const recordView *record_p, void *arg_p) {
+    printf("Data Element: %d %s\n", record_p->number, record_p->theString);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Print every record in the same format as PrintItem().
+ */
+int PrintCompactList (const compactList *compact_p) {
+    if (compact_p == NULL || compact_p->length == 0)
+        return EXIT_FAILURE;
+    CompactRecords(compact_p, PrintRecord, NULL);
+    return EXIT_SUCCESS;
+}
+
+/* Append a copy of a record at the front of a list */
+static int PrependRecord (const recordView *record_p, void *list_pp) {
+    node_p item_p = NewItem(record_p->number, (char *)record_p->theString);
+
+    if (item_p == NULL)
+        return EXIT_FAILURE;
+    *(GList **)list_pp = g_list_prepend(*(GList **)list_pp, item_p);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Build an ordinary list with a copy of every record.
+ */
+GList * ExpandCompactList (const compactList *compact_p) {
+    GList *theList_p = NULL;
+
+    CompactRecords(compact_p, PrependRecord, &theList_p);
+    return g_list_reverse(theList_p);
+}
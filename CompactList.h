@@ -0,0 +1,190 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    CompactList.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 20:10 CST
+ *
+ * @brief   Declares a compact, read-only copy of a sorted list of
+ *          @c myData items. Numbers are stored as variable-length deltas
+ *          and strings with the prefix they share with the previous one
+ *          removed, in blocks that can be searched without decoding the
+ *          whole list.
+ *
+ * References:
+ *          I. H. Witten, A. Moffat and T. C. Bell, "Managing Gigabytes",
+ *          2nd ed., 1999 (front coding and variable-byte codes).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 20:10 CST -- File created
+ *
+ * @note    Records are read as @c recordView values, the same ones the
+ *          streaming parser in RecordStream.h produces, so MatchRecord()
+ *          and the @c recordVisitor functions work on both.
+ *
+ */
+
+#ifndef COMPACTLIST_H
+#define COMPACTLIST_H
+
+#include <stddef.h>
+#include <glib.h>
+#include "UserDefined.h"
+#include "RecordStream.h"
+
+/** @def  COMPACT_BLOCKSIZE
+ * @brief Records per block. Seeks decode at most this many records.
+ */
+#define COMPACT_BLOCKSIZE 64
+
+/**
+ * @typedef compactList
+ *
+ * @brief Opaque compact list.
+ */
+typedef struct compactList_ compactList;
+
+/**
+ * @typedef compactIter
+ *
+ * @brief Opaque position in a compact list.
+ */
+typedef struct compactIter_ compactIter;
+
+/**
+ *
+ * @brief Build a compact copy of a sorted list.
+ *
+ * @param  myList_p pointer to a list sorted with
+ *         @c g_list_sort(list, CompareItems). It is not modified and may
+ *         be destroyed afterwards.
+ * @return pointer to the compact list, or NULL if @p myList_p is not
+ *         sorted by number or there is no memory.
+ *
+ * @code
+ *  theList_p = g_list_sort(theList_p, (GCompareFunc)CompareItems);
+ *  compact_p = NewCompactList(theList_p);
+ *  DestroyList(theList_p);
+ *  g_list_free(theList_p);
+ * @endcode
+ *
+ */
+compactList * NewCompactList (GList *myList_p);
+
+/**
+ *
+ * @brief De-allocate a compact list.
+ *
+ */
+void FreeCompactList (compactList *compact_p);
+
+/**
+ *
+ * @brief Number of records in a compact list.
+ *
+ */
+size_t CompactLength (const compactList *compact_p);
+
+/**
+ *
+ * @brief Bytes of memory used by a compact list, including its index.
+ *
+ */
+size_t CompactBytes (const compactList *compact_p);
+
+/**
+ *
+ * @brief Build an ordinary list with a copy of every record.
+ *
+ * @return pointer to the new list, to be destroyed with DestroyList(), or
+ *         NULL if it is empty or there is no memory.
+ *
+ */
+GList * ExpandCompactList (const compactList *compact_p);
+
+/**
+ *
+ * @brief Start reading a compact list from its first record.
+ *
+ * @return pointer to the iterator or NULL if there is no memory.
+ *
+ * @code
+ *  iter_p = NewCompactIter(compact_p);
+ *  while (CompactNext(iter_p, &record) != EOF)
+ *     printf("%d %s\n", record.number, record.theString);
+ *  FreeCompactIter(iter_p);
+ * @endcode
+ *
+ */
+compactIter * NewCompactIter (const compactList *compact_p);
+
+/**
+ *
+ * @brief De-allocate an iterator.
+ *
+ */
+void FreeCompactIter (compactIter *iter_p);
+
+/**
+ *
+ * @brief Read the next record.
+ *
+ * @param  iter_p pointer to the iterator.
+ * @param  record_p where the record is stored. Its string is only valid
+ *         until the next call with the same iterator.
+ * @return @c EXIT_SUCCESS if a record was read, @c EOF at the end.
+ *
+ */
+int CompactNext (compactIter *iter_p, recordView *record_p);
+
+/**
+ *
+ * @brief Move an iterator to the first record with a number equal to or
+ * greater than a value.
+ *
+ * @b CompactSeek() finds the block with a binary search over the index and
+ * then decodes at most one block.
+ *
+ */
+void CompactSeek (compactIter *iter_p, int number);
+
+/**
+ *
+ * @brief Find the first record that matches a value.
+ *
+ * @param  compact_p pointer to the compact list.
+ * @param  value_p pointer to the user-defined data value to match.
+ * @param  key which field to match, as in FindInList(). Numbers are found
+ *         with CompactSeek(), strings with a scan.
+ * @param  record_p where the record found is stored, its string is valid
+ *         until the list is freed or the next call to CompactFind().
+ * @return @c EXIT_SUCCESS if a record was found, otherwise
+ *         @c EXIT_FAILURE.
+ *
+ */
+int CompactFind (compactList *compact_p, const void *value_p, int key,
+                 recordView *record_p);
+
+/**
+ *
+ * @brief Call a visitor for every record of a compact list.
+ *
+ * @return number of records visited.
+ *
+ */
+long CompactRecords (const compactList *compact_p, recordVisitor visit,
+                     void *arg_p);
+
+/**
+ *
+ * @brief Print every record in the same format as PrintItem().
+ *
+ * @return @c EXIT_SUCCESS if the list was printed, @c EXIT_FAILURE if it
+ *         is empty.
+ *
+ */
+int PrintCompactList (const compactList *compact_p);
+
+#endif
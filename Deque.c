@@ -0,0 +1,401 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Deque.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 03:15 CST
+ *
+ * @brief   Implements the ring-buffer deque and the lock-free queues.
+ *
+ * References:
+ *          Uses the C11 atomics, as SnapshotList.c does.
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 03:15 CST -- File created
+ *
+ * @note    All the buffers have a power of two of slots, so a position is
+ *          reduced to a slot with a mask. The indexes of the queues only
+ *          grow, the number of items is their difference, and a size_t
+ *          does not wrap around in practice.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <string.h>                                 /* Used for memcpy */
+#include <stdatomic.h>                        /* Used for the atomics */
+#include <glib.h>                   /* Used for the doubly-linked lists */
+#include "Deque.h"                                    /* Function header */
+
+/** @def  QUEUE_CACHELINE
+ * @brief Bytes between the fields written by different threads.
+ */
+#define QUEUE_CACHELINE 64
+
+struct nodeDeque_{
+    node_p * slots;
+    size_t   mask;                         /* Slots - 1                  */
+    size_t   head;                         /* Slot of the first item     */
+    size_t   count;
+};
+
+struct spscQueue_{
+    _Alignas(QUEUE_CACHELINE) _Atomic size_t head;  /* Next to pop       */
+    size_t                    tailCopy;    /* Consumer's copy of tail    */
+    _Alignas(QUEUE_CACHELINE) _Atomic size_t tail;  /* Next to push      */
+    size_t                    headCopy;    /* Producer's copy of head    */
+    _Alignas(QUEUE_CACHELINE) size_t mask;
+    node_p                  * slots;
+};
+
+typedef struct mpscSlot_{
+    _Atomic size_t sequence;               /* Position + 1 once written  */
+    node_p         item;
+}mpscSlot;
+
+struct mpscQueue_{
+    _Alignas(QUEUE_CACHELINE) _Atomic size_t tail;  /* Next to reserve   */
+    _Alignas(QUEUE_CACHELINE) size_t head;          /* Next to pop       */
+    _Alignas(QUEUE_CACHELINE) size_t mask;
+    mpscSlot                * slots;
+};
+
+/* Smallest power of two not below a number */
+static size_t RoundUp (size_t number, size_t minimum) {
+    size_t power = minimum;
+
+    while (power < number)
+        power <<= 1;
+    return power;
+}
+
+/**
+ * @brief Allocate an empty deque.
+ */
+nodeDeque * NewDeque (size_t capacity) {
+    nodeDeque *deque_p = malloc(sizeof(nodeDeque));
+
+    if (deque_p == NULL)
+        return NULL;
+    capacity = RoundUp(capacity, DEQUE_MINCAPACITY);
+    deque_p->slots = malloc(capacity * sizeof(node_p));
+    if (deque_p->slots == NULL) {
+        free(deque_p);
+        return NULL;
+    }
+    deque_p->mask = capacity - 1;
+    deque_p->head = deque_p->count = 0;
+    return deque_p;
+}
+
+/**
+ * @brief Build a deque with the items of a list.
+ */
+nodeDeque * DequeFromList (GList *myList_p) {
+    nodeDeque *deque_p = NewDeque(g_list_length(myList_p));
+
+    if (deque_p == NULL)
+        return NULL;
+    for (; myList_p != NULL; myList_p = myList_p->next)
+        deque_p->slots[deque_p->count++] = myList_p->data;
+    return deque_p;
+}
+
+/**
+ * @brief De-allocate a deque but not its items.
+ */
+void FreeDeque (nodeDeque *deque_p) {
+    if (deque_p == NULL)
+        return;
+    free(deque_p->slots);
+    free(deque_p);
+}
+
+/**
+ * @brief De-allocate a deque and its items.
+ */
+void DestroyDeque (nodeDeque *deque_p) {
+    size_t i;
+
+    if (deque_p == NULL)
+        return;
+    for (i = 0; i < deque_p->count; i++)
+        FreeItem(deque_p->slots[(deque_p->head + i) & deque_p->mask]);
+    FreeDeque(deque_p);
+}
+
+/**
+ * @brief Number of items.
+ */
+size_t DequeLength (const nodeDeque *deque_p) {
+    return deque_p->count;
+}
+
+/* Double the buffer, the items are unwrapped to start at slot 0 */
+static int Grow (nodeDeque *deque_p) {
+    size_t  capacity = deque_p->mask + 1;
+    size_t  first = capacity - deque_p->head;    /* Items before the wrap */
+    node_p *slots = malloc(2 * capacity * sizeof(node_p));
+
+    if (slots == NULL)
+        return EXIT_FAILURE;
+    memcpy(slots, deque_p->slots + deque_p->head, first * sizeof(node_p));
+    memcpy(slots + first, deque_p->slots, deque_p->head * sizeof(node_p));
+    free(deque_p->slots);
+    deque_p->slots = slots;
+    deque_p->mask = 2 * capacity - 1;
+    deque_p->head = 0;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Add an item after the last one.
+ */
+int DequePushBack (nodeDeque *deque_p, node_p item_p) {
+    if (deque_p->count > deque_p->mask && Grow(deque_p) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+    deque_p->slots[(deque_p->head + deque_p->count++) & deque_p->mask] =
+        item_p;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Add an item before the first one.
+ */
+int DequePushFront (nodeDeque *deque_p, node_p item_p) {
+    if (deque_p->count > deque_p->mask && Grow(deque_p) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+    deque_p->head = (deque_p->head - 1) & deque_p->mask;
+    deque_p->slots[deque_p->head] = item_p;
+    deque_p->count++;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Take out the first item.
+ */
+node_p DequePopFront (nodeDeque *deque_p) {
+    node_p item_p;
+
+    if (deque_p->count == 0)
+        return NULL;
+    item_p = deque_p->slots[deque_p->head];
+    deque_p->head = (deque_p->head + 1) & deque_p->mask;
+    deque_p->count--;
+    return item_p;
+}
+
+/**
+ * @brief Take out the last item.
+ */
+node_p DequePopBack (nodeDeque *deque_p) {
+    if (deque_p->count == 0)
+        return NULL;
+    deque_p->count--;
+    return deque_p->slots[(deque_p->head + deque_p->count) & deque_p->mask];
+}
+
+/**
+ * @brief Item at a position, counting from 0 at the front.
+ */
+node_p DequeNth (const nodeDeque *deque_p, size_t position) {
+    if (position >= deque_p->count)
+        return NULL;
+    return deque_p->slots[(deque_p->head + position) & deque_p->mask];
+}
+
+/**
+ * @brief Call a visitor for every item, from the front.
+ */
+node_p DequeForEach (const nodeDeque *deque_p, itemVisitor visit,
+                     void *arg_p) {
+    node_p item_p;
+    size_t i;
+
+    for (i = 0; i < deque_p->count; i++) {
+        item_p = deque_p->slots[(deque_p->head + i) & deque_p->mask];
+        if (visit(item_p, arg_p) != EXIT_SUCCESS)
+            return item_p;
+    }
+    return NULL;
+}
+
+/**
+ * @brief Make a list with the items, from the front.
+ */
+GList * DequeToList (const nodeDeque *deque_p) {
+    GList *theList_p = NULL;
+    size_t i;
+
+    for (i = deque_p->count; i > 0; i--)
+        theList_p = g_list_prepend(theList_p,
+                        deque_p->slots[(deque_p->head + i - 1) &
+                                       deque_p->mask]);
+    return theList_p;
+}
+
+static int PrintVisitor (node_p item_p, void *arg_p) {
+    return PrintItem(item_p);
+}
+
+/**
+ * @brief Print every item with PrintItem().
+ */
+int PrintDeque (const nodeDeque *deque_p) {
+    if (deque_p->count == 0 ||
+        DequeForEach(deque_p, PrintVisitor, NULL) != NULL)
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Allocate an empty queue for one producer and one consumer.
+ */
+spscQueue * NewSpscQueue (size_t capacity) {
+    spscQueue *queue_p = aligned_alloc(QUEUE_CACHELINE, sizeof(spscQueue));
+
+    if (queue_p == NULL)
+        return NULL;
+    capacity = RoundUp(capacity, 2);
+    queue_p->slots = malloc(capacity * sizeof(node_p));
+    if (queue_p->slots == NULL) {
+        free(queue_p);
+        return NULL;
+    }
+    atomic_init(&queue_p->head, 0);
+    atomic_init(&queue_p->tail, 0);
+    queue_p->tailCopy = queue_p->headCopy = 0;
+    queue_p->mask = capacity - 1;
+    return queue_p;
+}
+
+/**
+ * @brief De-allocate a queue but not its items.
+ */
+void FreeSpscQueue (spscQueue *queue_p) {
+    if (queue_p == NULL)
+        return;
+    free(queue_p->slots);
+    free(queue_p);
+}
+
+/**
+ * @brief Add an item at the end, only called by the producer.
+ */
+int SpscPush (spscQueue *queue_p, node_p item_p) {
+    size_t tail = atomic_load_explicit(&queue_p->tail, memory_order_relaxed);
+
+    if (tail - queue_p->headCopy > queue_p->mask) {
+        queue_p->headCopy = atomic_load_explicit(&queue_p->head,
+                                                 memory_order_acquire);
+        if (tail - queue_p->headCopy > queue_p->mask)
+            return EXIT_FAILURE;                             /* Full */
+    }
+    queue_p->slots[tail & queue_p->mask] = item_p;
+    atomic_store_explicit(&queue_p->tail, tail + 1, memory_order_release);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Take out the first item, only called by the consumer.
+ */
+node_p SpscPop (spscQueue *queue_p) {
+    size_t head = atomic_load_explicit(&queue_p->head, memory_order_relaxed);
+    node_p item_p;
+
+    if (head == queue_p->tailCopy) {
+        queue_p->tailCopy = atomic_load_explicit(&queue_p->tail,
+                                                 memory_order_acquire);
+        if (head == queue_p->tailCopy)
+            return NULL;                                     /* Empty */
+    }
+    item_p = queue_p->slots[head & queue_p->mask];
+    atomic_store_explicit(&queue_p->head, head + 1, memory_order_release);
+    return item_p;
+}
+
+/**
+ * @brief Allocate an empty queue for many producers and one consumer.
+ */
+mpscQueue * NewMpscQueue (size_t capacity) {
+    mpscQueue *queue_p = aligned_alloc(QUEUE_CACHELINE, sizeof(mpscQueue));
+    size_t     i;
+
+    if (queue_p == NULL)
+        return NULL;
+    capacity = RoundUp(capacity, 2);
+    queue_p->slots = malloc(capacity * sizeof(mpscSlot));
+    if (queue_p->slots == NULL) {
+        free(queue_p);
+        return NULL;
+    }
+    for (i = 0; i < capacity; i++)
+        atomic_init(&queue_p->slots[i].sequence, i);
+    atomic_init(&queue_p->tail, 0);
+    queue_p->head = 0;
+    queue_p->mask = capacity - 1;
+    return queue_p;
+}
+
+/**
+ * @brief De-allocate a queue but not its items.
+ */
+void FreeMpscQueue (mpscQueue *queue_p) {
+    if (queue_p == NULL)
+        return;
+    free(queue_p->slots);
+    free(queue_p);
+}
+
+/**
+ * @brief Add an item at the end, from any thread.
+ */
+int MpscPush (mpscQueue *queue_p, node_p item_p) {
+    size_t    tail = atomic_load_explicit(&queue_p->tail,
+                                          memory_order_relaxed);
+    mpscSlot *slot_p;
+    size_t    sequence;
+
+    /*
+     * A slot is free for position tail when its sequence is tail. If it is
+     * behind, the consumer has not taken the item a lap ago, so the queue
+     * is full. If it is ahead, another producer took the position.
+     */
+    for (;;) {
+        slot_p = &queue_p->slots[tail & queue_p->mask];
+        sequence = atomic_load_explicit(&slot_p->sequence,
+                                        memory_order_acquire);
+        if (sequence == tail) {
+            if (atomic_compare_exchange_weak_explicit(&queue_p->tail, &tail,
+                    tail + 1, memory_order_relaxed, memory_order_relaxed))
+                break;
+        } else if ((ptrdiff_t)(sequence - tail) < 0) {
+            return EXIT_FAILURE;                                 /* Full */
+        } else {
+            tail = atomic_load_explicit(&queue_p->tail,
+                                        memory_order_relaxed);
+        }
+    }
+    slot_p->item = item_p;
+    atomic_store_explicit(&slot_p->sequence, tail + 1, memory_order_release);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Take out the first item, only called by the consumer.
+ */
+node_p MpscPop (mpscQueue *queue_p) {
+    mpscSlot *slot_p = &queue_p->slots[queue_p->head & queue_p->mask];
+    node_p    item_p;
+
+    if (atomic_load_explicit(&slot_p->sequence, memory_order_acquire) !=
+        queue_p->head + 1)
+        return NULL;                              /* Empty or not written */
+    item_p = slot_p->item;
+    /* Free for the position one lap ahead */
+    atomic_store_explicit(&slot_p->sequence, queue_p->head + queue_p->mask + 1,
+                          memory_order_release);
+    queue_p->head++;
+    return item_p;
+}
@@ -0,0 +1,288 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Deque.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 03:15 CST
+ *
+ * @brief   Declares a double-ended queue of @c myData items kept in a ring
+ *          buffer, for lists that are only used at their ends, and two
+ *          lock-free bounded queues to pass items between threads: one
+ *          producer and one consumer, or many producers and one consumer.
+ *
+ * References:
+ *          D. E. Knuth, "The Art of Computer Programming", vol. 1, section
+ *          2.2.2 (sequential allocation of queues).
+ *          L. Lamport, "Specifying concurrent program modules", ACM TOPLAS
+ *          5(2), 1983 (the single-producer single-consumer ring).
+ *          D. Vyukov, "Bounded MPMC queue", 1024cores.net, 2010 (the
+ *          sequence numbers of the many-producer queue).
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 03:15 CST -- File created
+ *
+ * @note    Appending to a GList with g_list_append() and taking its last
+ *          element with g_list_last() walk the whole list, and every push
+ *          and pop allocates or frees a link. The deque pushes and pops at
+ *          both ends in constant amortized time and only allocates when
+ *          its buffer doubles. It does not shrink.
+ *
+ * @warning The deque is not thread safe. The queues are safe only for the
+ *          number of producers and consumers in their name, and they never
+ *          grow: a push to a full queue fails.
+ *
+ */
+
+#ifndef DEQUE_H
+#define DEQUE_H
+
+#include <stddef.h>
+#include <glib.h>
+#include "UserDefined.h"
+#include "Traverse.h"
+
+/** @def  DEQUE_MINCAPACITY
+ * @brief Smallest buffer of a deque, in items.
+ */
+#define DEQUE_MINCAPACITY 16
+
+/**
+ * @typedef nodeDeque
+ *
+ * @brief Opaque double-ended queue.
+ */
+typedef struct nodeDeque_ nodeDeque;
+
+/**
+ * @typedef spscQueue
+ *
+ * @brief Opaque lock-free queue with one producer and one consumer.
+ */
+typedef struct spscQueue_ spscQueue;
+
+/**
+ * @typedef mpscQueue
+ *
+ * @brief Opaque lock-free queue with many producers and one consumer.
+ */
+typedef struct mpscQueue_ mpscQueue;
+
+/**
+ *
+ * @brief Allocate an empty deque.
+ *
+ * @param  capacity items that fit before the buffer grows, it is rounded
+ *         up to a power of two of at least @c DEQUE_MINCAPACITY.
+ * @return pointer to the new deque or NULL if there is no memory.
+ *
+ * @code
+ *  deque_p = NewDeque(0);
+ *  DequePushBack(deque_p, NewItem(1, "Huey"));
+ *  item_p = DequePopFront(deque_p);                     // first in
+ * @endcode
+ *
+ */
+nodeDeque * NewDeque (size_t capacity);
+
+/**
+ *
+ * @brief Build a deque with the items of a list, in the same order. The
+ * list is not changed and its items are shared, not copied.
+ *
+ * @return pointer to the new deque or NULL if there is no memory.
+ *
+ */
+nodeDeque * DequeFromList (GList *myList_p);
+
+/**
+ *
+ * @brief De-allocate a deque but not its items.
+ *
+ */
+void FreeDeque (nodeDeque *deque_p);
+
+/**
+ *
+ * @brief De-allocate a deque and its items, with FreeItem().
+ *
+ */
+void DestroyDeque (nodeDeque *deque_p);
+
+/**
+ *
+ * @brief Number of items.
+ *
+ */
+size_t DequeLength (const nodeDeque *deque_p);
+
+/**
+ *
+ * @brief Add an item after the last one, as g_list_append().
+ *
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if the buffer had to grow
+ *         and there is no memory.
+ *
+ */
+int DequePushBack (nodeDeque *deque_p, node_p item_p);
+
+/**
+ *
+ * @brief Add an item before the first one, as g_list_prepend().
+ *
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if the buffer had to grow
+ *         and there is no memory.
+ *
+ */
+int DequePushFront (nodeDeque *deque_p, node_p item_p);
+
+/**
+ *
+ * @brief Take out the first item. It is not de-allocated.
+ *
+ * @return the item, or NULL if the deque is empty.
+ *
+ */
+node_p DequePopFront (nodeDeque *deque_p);
+
+/**
+ *
+ * @brief Take out the last item. It is not de-allocated.
+ *
+ * @return the item, or NULL if the deque is empty.
+ *
+ */
+node_p DequePopBack (nodeDeque *deque_p);
+
+/**
+ *
+ * @brief Item at a position, counting from 0 at the front, in constant
+ * time.
+ *
+ * @return the item, or NULL if @p position is out of range.
+ *
+ */
+node_p DequeNth (const nodeDeque *deque_p, size_t position);
+
+/**
+ *
+ * @brief Call a visitor for every item, from the front, as ListForEach().
+ *
+ * @return the item where @p visit stopped, or NULL if every item was
+ *         visited.
+ *
+ */
+node_p DequeForEach (const nodeDeque *deque_p, itemVisitor visit,
+                     void *arg_p);
+
+/**
+ *
+ * @brief Make a list with the items, from the front. The items are shared.
+ *
+ */
+GList * DequeToList (const nodeDeque *deque_p);
+
+/**
+ *
+ * @brief Print every item with PrintItem(), as PrintList().
+ *
+ * @return @c EXIT_SUCCESS if the deque was printed, @c EXIT_FAILURE if it
+ *         is empty or an item could not be printed.
+ *
+ */
+int PrintDeque (const nodeDeque *deque_p);
+
+/**
+ *
+ * @brief Allocate an empty queue for one producer and one consumer thread.
+ *
+ * The producer and the consumer indexes are kept in different cache lines,
+ * and each side keeps a copy of the other's index, so it only reads the
+ * shared one when the queue looks full or empty.
+ *
+ * @param  capacity items it holds, rounded up to a power of two.
+ * @return pointer to the new queue or NULL if there is no memory.
+ *
+ */
+spscQueue * NewSpscQueue (size_t capacity);
+
+/**
+ *
+ * @brief De-allocate a queue but not the items left in it. No thread may
+ * be using it.
+ *
+ */
+void FreeSpscQueue (spscQueue *queue_p);
+
+/**
+ *
+ * @brief Add an item at the end. Only called by the producer.
+ *
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if the queue is full.
+ *
+ */
+int SpscPush (spscQueue *queue_p, node_p item_p);
+
+/**
+ *
+ * @brief Take out the first item. Only called by the consumer.
+ *
+ * @return the item, or NULL if the queue is empty.
+ *
+ */
+node_p SpscPop (spscQueue *queue_p);
+
+/**
+ *
+ * @brief Allocate an empty queue for many producer threads and one
+ * consumer thread.
+ *
+ * Producers reserve a slot with a compare-and-swap on the end of the
+ * queue, and every slot has a sequence number that tells the consumer
+ * when its item has been written.
+ *
+ * @param  capacity items it holds, rounded up to a power of two.
+ * @return pointer to the new queue or NULL if there is no memory.
+ *
+ * @code
+ *  // Producers                          // Consumer
+ *  while (MpscPush(queue_p, item_p)      while ((item_p = MpscPop(queue_p))
+ *         != EXIT_SUCCESS)                      == NULL)
+ *     g_thread_yield();                     g_thread_yield();
+ * @endcode
+ *
+ */
+mpscQueue * NewMpscQueue (size_t capacity);
+
+/**
+ *
+ * @brief De-allocate a queue but not the items left in it. No thread may
+ * be using it.
+ *
+ */
+void FreeMpscQueue (mpscQueue *queue_p);
+
+/**
+ *
+ * @brief Add an item at the end. It may be called by any thread.
+ *
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if the queue is full.
+ *
+ */
+int MpscPush (mpscQueue *queue_p, node_p item_p);
+
+/**
+ *
+ * @brief Take out the first item. Only called by the consumer.
+ *
+ * Items pushed by the same producer come out in the order they were
+ * pushed.
+ *
+ * @return the item, or NULL if the queue is empty or the producer of the
+ *         first item has not finished writing it.
+ *
+ */
+node_p MpscPop (mpscQueue *queue_p);
+
+#endif
@@ -0,0 +1,673 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    DiskList.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 22:30 CST
+ *
+ * @brief   Implements the disk-backed list, its page cache and its
+ *          external merge sort.
+ *
+ * References:
+ *          H. Garcia-Molina, J. D. Ullman and J. Widom, "Database Systems:
+ *          The Complete Book", 2nd ed., 2008 (buffer management and the
+ *          two-phase multiway merge sort).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 22:30 CST -- File created
+ *          Mon 19 Oct 2026 04:50 CST -- The sort uses the memory of the
+ *                                       page cache, and the list is only
+ *                                       emptied once the merge is ready
+ *
+ * @note    A page starts with the number of records it holds and the
+ *          number of bytes used, two 16-bit values. Each record is its
+ *          number (32 bits), the length of its string (16 bits) and the
+ *          string with its terminator, without any alignment. The runs of
+ *          the sort use the same record format, one after another.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <stdio.h>                     /* Used for printf() & tmpfile() */
+#include <string.h>                       /* Used for memcpy & strlen */
+#include <stdint.h>                       /* Used for the record fields */
+#include <fcntl.h>                                     /* Used for open */
+#include <unistd.h>                    /* Used for pread, pwrite & close */
+#include <glib.h>                  /* Used for the hash table of pages */
+#include "DiskList.h"                                 /* Function header */
+#include "UserDefined.h"              /* Used for the order & key enums */
+
+#define PAGE_HEADER   4                    /* count and used             */
+#define RECORD_HEADER 6                    /* number and length          */
+
+/* A page in memory */
+typedef struct frame_{
+    long            page;                  /* Page held, -1 if none      */
+    int             dirty;                 /* Changed since it was read  */
+    long            newer;                 /* Neighbours in LRU order    */
+    long            older;
+    unsigned char * data;
+}frame;
+
+struct diskList_{
+    int            fd;                     /* File with the pages        */
+    FILE         * temporary;              /* Owns fd if path was NULL   */
+    size_t         budget;                 /* Bytes of memory            */
+    long           pages;                  /* Pages in the list          */
+    long           records;
+    frame        * frames;
+    long           numFrames;
+    long           usedFrames;
+    long           newest;                 /* Ends of the LRU order      */
+    long           oldest;
+    GHashTable   * where;                  /* Page number -> frame + 1   */
+    unsigned char* memory;                 /* Data of every frame        */
+    char           found[DISK_PAGESIZE];   /* String found by DiskFind   */
+    diskStats      stats;
+};
+
+/* Unaligned fields of pages and records */
+static inline unsigned int Get16 (const unsigned char *p) {
+    uint16_t value;
+
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline void Put16 (unsigned char *p, unsigned int value) {
+    uint16_t v = value;
+
+    memcpy(p, &v, sizeof(v));
+}
+
+static inline int Get32 (const unsigned char *p) {
+    int32_t value;
+
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline void Put32 (unsigned char *p, int value) {
+    int32_t v = value;
+
+    memcpy(p, &v, sizeof(v));
+}
+
+/* Write a record at p, returns the bytes written */
+static inline size_t PutRecord (unsigned char *p, int number,
+                                const char *theString, size_t length) {
+    Put32(p, number);
+    Put16(p + 4, length);
+    memcpy(p + RECORD_HEADER, theString, length + 1);
+    return RECORD_HEADER + length + 1;
+}
+
+/* Read the record at p, returns its size */
+static inline size_t GetRecord (const unsigned char *p,
+                                recordView *record_p) {
+    record_p->number = Get32(p);
+    record_p->length = Get16(p + 4);
+    record_p->theString = (const char *)p + RECORD_HEADER;
+    return RECORD_HEADER + record_p->length + 1;
+}
+
+/* Take a frame out of the LRU order */
+static void Unlink (diskList *disk_p, long f) {
+    frame *frame_p = &disk_p->frames[f];
+
+    if (frame_p->newer >= 0)
+        disk_p->frames[frame_p->newer].older = frame_p->older;
+    else
+        disk_p->newest = frame_p->older;
+    if (frame_p->older >= 0)
+        disk_p->frames[frame_p->older].newer = frame_p->newer;
+    else
+        disk_p->oldest = frame_p->newer;
+}
+
+/* Make a frame the most recently used one */
+static void MakeNewest (diskList *disk_p, long f) {
+    frame *frame_p = &disk_p->frames[f];
+
+    frame_p->newer = -1;
+    frame_p->older = disk_p->newest;
+    if (disk_p->newest >= 0)
+        disk_p->frames[disk_p->newest].newer = f;
+    disk_p->newest = f;
+    if (disk_p->oldest < 0)
+        disk_p->oldest = f;
+}
+
+static int WriteFrame (diskList *disk_p, frame *frame_p) {
+    if (pwrite(disk_p->fd, frame_p->data, DISK_PAGESIZE,
+               (off_t)frame_p->page * DISK_PAGESIZE) != DISK_PAGESIZE)
+        return EXIT_FAILURE;
+    frame_p->dirty = FALSE;
+    disk_p->stats.writes++;
+    return EXIT_SUCCESS;
+}
+
+/*
+ * Get a page in memory, the least recently used one is replaced if there
+ * is no free frame. A new page is started empty instead of being read.
+ */
+static unsigned char * GetPage (diskList *disk_p, long page, int isNew) {
+    gpointer found = g_hash_table_lookup(disk_p->where,
+                                         GINT_TO_POINTER(page));
+    frame   *frame_p;
+    long     f;
+
+    if (found != NULL) {
+        f = GPOINTER_TO_INT(found) - 1;
+        disk_p->stats.hits++;
+        if (disk_p->newest != f) {
+            Unlink(disk_p, f);
+            MakeNewest(disk_p, f);
+        }
+        return disk_p->frames[f].data;
+    }
+
+    disk_p->stats.misses++;
+    if (disk_p->usedFrames < disk_p->numFrames) {
+        f = disk_p->usedFrames++;
+    } else {
+        f = disk_p->oldest;
+        frame_p = &disk_p->frames[f];
+        if (frame_p->dirty && WriteFrame(disk_p, frame_p) != EXIT_SUCCESS)
+            return NULL;
+        g_hash_table_remove(disk_p->where, GINT_TO_POINTER(frame_p->page));
+        Unlink(disk_p, f);
+    }
+
+    frame_p = &disk_p->frames[f];
+    frame_p->page = -1;
+    if (isNew) {
+        Put16(frame_p->data, 0);
+        Put16(frame_p->data + 2, PAGE_HEADER);
+        frame_p->dirty = TRUE;
+    } else {
+        frame_p->dirty = FALSE;
+        if (pread(disk_p->fd, frame_p->data, DISK_PAGESIZE,
+                  (off_t)page * DISK_PAGESIZE) != DISK_PAGESIZE) {
+            MakeNewest(disk_p, f);            /* Kept without any page */
+            return NULL;
+        }
+        disk_p->stats.reads++;
+    }
+    frame_p->page = page;
+    g_hash_table_insert(disk_p->where, GINT_TO_POINTER(page),
+                        GINT_TO_POINTER(f + 1));
+    MakeNewest(disk_p, f);
+    return frame_p->data;
+}
+
+/* Forget every page in memory, without writing them */
+static void DropPages (diskList *disk_p) {
+    g_hash_table_remove_all(disk_p->where);
+    disk_p->usedFrames = 0;
+    disk_p->newest = disk_p->oldest = -1;
+}
+
+/**
+ * @brief Create an empty disk-backed list.
+ */
+diskList * NewDiskList (const char *path, size_t memoryBudget) {
+    diskList *disk_p = calloc(1, sizeof(diskList));
+    long      f;
+
+    if (disk_p == NULL)
+        return NULL;
+    if (path == NULL) {
+        disk_p->temporary = tmpfile();
+        disk_p->fd = disk_p->temporary ? fileno(disk_p->temporary) : -1;
+    } else {
+        disk_p->fd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0600);
+    }
+    if (disk_p->fd < 0) {
+        free(disk_p);
+        return NULL;
+    }
+
+    disk_p->budget = memoryBudget;
+    disk_p->numFrames = memoryBudget / DISK_PAGESIZE;
+    if (disk_p->numFrames < DISK_MINPAGES)
+        disk_p->numFrames = DISK_MINPAGES;
+    disk_p->frames = malloc(disk_p->numFrames * sizeof(frame));
+    disk_p->memory = malloc(disk_p->numFrames * DISK_PAGESIZE);
+    disk_p->where = g_hash_table_new(g_direct_hash, g_direct_equal);
+    if (disk_p->frames == NULL || disk_p->memory == NULL) {
+        CloseDiskList(disk_p);
+        return NULL;
+    }
+    for (f = 0; f < disk_p->numFrames; f++)
+        disk_p->frames[f].data = disk_p->memory + f * DISK_PAGESIZE;
+    disk_p->newest = disk_p->oldest = -1;
+    disk_p->stats.frames = disk_p->numFrames;
+    return disk_p;
+}
+
+/**
+ * @brief Write every changed page to the file.
+ */
+int FlushDiskList (diskList *disk_p) {
+    long f;
+
+    for (f = 0; f < disk_p->usedFrames; f++)
+        if (disk_p->frames[f].dirty &&
+            WriteFrame(disk_p, &disk_p->frames[f]) != EXIT_SUCCESS)
+            return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Write the changed pages and de-allocate a disk-backed list.
+ */
+void CloseDiskList (diskList *disk_p) {
+    if (disk_p == NULL)
+        return;
+    if (disk_p->frames != NULL && disk_p->temporary == NULL)
+        FlushDiskList(disk_p);
+    if (disk_p->temporary != NULL)
+        fclose(disk_p->temporary);
+    else
+        close(disk_p->fd);
+    g_hash_table_destroy(disk_p->where);
+    free(disk_p->frames);
+    free(disk_p->memory);
+    free(disk_p);
+}
+
+/* Append a record whose length is known */
+static int AppendRecord (diskList *disk_p, int number, const char *theString,
+                         size_t length) {
+    size_t         size = RECORD_HEADER + length + 1;
+    unsigned char *data = NULL;
+    unsigned int   used;
+
+    if (length > DISK_MAXSTRING)
+        return EXIT_FAILURE;
+    if (disk_p->pages > 0) {
+        data = GetPage(disk_p, disk_p->pages - 1, FALSE);
+        if (data == NULL)
+            return EXIT_FAILURE;
+        if (Get16(data + 2) + size > DISK_PAGESIZE)
+            data = NULL;                            /* Start a new page */
+    }
+    if (data == NULL) {
+        data = GetPage(disk_p, disk_p->pages, TRUE);
+        if (data == NULL)
+            return EXIT_FAILURE;
+        disk_p->pages++;
+    }
+
+    used = Get16(data + 2);
+    PutRecord(data + used, number, theString, length);
+    Put16(data, Get16(data) + 1);
+    Put16(data + 2, used + size);
+    disk_p->frames[disk_p->newest].dirty = TRUE;
+    disk_p->records++;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Append a record at the end of the list.
+ */
+int DiskAppend (diskList *disk_p, int number, const char *theString) {
+    return AppendRecord(disk_p, number, theString, strlen(theString));
+}
+
+/**
+ * @brief Append every remaining record of a stream.
+ */
+long DiskAppendStream (diskList *disk_p, recordStream *stream_p) {
+    recordView record;
+    long       count = 0;
+
+    while (NextRecord(stream_p, &record) != EOF) {
+        if (AppendRecord(disk_p, record.number, record.theString,
+                         record.length) != EXIT_SUCCESS)
+            return -1;
+        count++;
+    }
+    return count;
+}
+
+/**
+ * @brief Number of records in the list.
+ */
+long DiskLength (const diskList *disk_p) {
+    return disk_p->records;
+}
+
+/**
+ * @brief Call a visitor for every record of the list, in order.
+ */
+long DiskRecords (diskList *disk_p, recordVisitor visit, void *arg_p) {
+    const unsigned char *data;
+    recordView           record;
+    unsigned int         count, r;
+    size_t               offset;
+    long                 page, visited = 0;
+
+    for (page = 0; page < disk_p->pages; page++) {
+        data = GetPage(disk_p, page, FALSE);
+        if (data == NULL)
+            return -1;
+        count = Get16(data);
+        for (r = 0, offset = PAGE_HEADER; r < count; r++) {
+            offset += GetRecord(data + offset, &record);
+            visited++;
+            if (visit(&record, arg_p) != EXIT_SUCCESS)
+                return visited;
+        }
+    }
+    return visited;
+}
+
+/* Value searched by DiskFind() */
+typedef struct diskFind_{
+    const void * value_p;
+    int          key;
+    recordView * record_p;
+    int          found;
+}diskFind;
+
+static int FindRecord (const recordView *record_p, void *arg_p) {
+    diskFind *find_p = arg_p;
+
+    if (MatchRecord(record_p, find_p->value_p, find_p->key) != EQUAL)
+        return EXIT_SUCCESS;
+    *find_p->record_p = *record_p;
+    find_p->found = TRUE;
+    return EXIT_FAILURE;                              /* Stop at the first */
+}
+
+/**
+ * @brief Find the first record that matches a value.
+ */
+long DiskFind (diskList *disk_p, const void *value_p, int key,
+               recordView *record_p) {
+    diskFind find = {value_p, key, record_p, FALSE};
+    long     visited = DiskRecords(disk_p, FindRecord, &find);
+
+    if (!find.found)
+        return -1;
+    /* The page may be replaced later, keep a copy of the string */
+    memcpy(disk_p->found, record_p->theString, record_p->length + 1);
+    record_p->theString = disk_p->found;
+    return visited - 1;
+}
+
+static int PrintRecord (const recordView *record_p, void *arg_p) {
+    printf("Data Element: %d %s\n", record_p->number, record_p->theString);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Print every record in the same format as PrintItem().
+ */
+int PrintDiskList (diskList *disk_p) {
+    if (disk_p->records == 0 || DiskRecords(disk_p, PrintRecord, NULL) < 0)
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Get the page cache counters.
+ */
+void DiskListStats (const diskList *disk_p, diskStats *stats_p) {
+    *stats_p = disk_p->stats;
+    stats_p->pages = disk_p->pages;
+}
+
+/*************************************************************************
+ *                         External merge sort                           *
+ *************************************************************************/
+
+/* A record of the run being built */
+typedef struct runEntry_{
+    int    number;
+    size_t offset;                         /* Position in the arena      */
+}runEntry;
+
+/* Runs written so far and the one being built */
+typedef struct runs_{
+    FILE         * file;                   /* Every run, one after another */
+    off_t        * ends;                   /* End of each run in the file */
+    long           count;
+    runEntry     * entries;
+    size_t         numEntries, maxEntries;
+    unsigned char* arena;                  /* Records of the current run */
+    size_t         used, size;
+    off_t          written;
+    int            failed;                 /* A run could not be written */
+}runs;
+
+/* Same number: the earlier record goes first, so the sort is stable */
+static int CompareEntries (const void *a, const void *b) {
+    const runEntry *x = a, *y = b;
+
+    if (x->number != y->number)
+        return x->number < y->number ? -1 : 1;
+    return x->offset < y->offset ? -1 : x->offset > y->offset;
+}
+
+/* Sort the run being built and write it after the previous ones */
+static int WriteRun (runs *runs_p) {
+    recordView record;
+    off_t     *ends;
+    size_t     i, size;
+
+    if (runs_p->numEntries == 0)
+        return EXIT_SUCCESS;
+    qsort(runs_p->entries, runs_p->numEntries, sizeof(runEntry),
+          CompareEntries);
+    for (i = 0; i < runs_p->numEntries; i++) {
+        size = GetRecord(runs_p->arena + runs_p->entries[i].offset, &record);
+        if (fwrite(runs_p->arena + runs_p->entries[i].offset, size, 1,
+                   runs_p->file) != 1)
+            return EXIT_FAILURE;
+        runs_p->written += size;
+    }
+    ends = realloc(runs_p->ends, (runs_p->count + 1) * sizeof(off_t));
+    if (ends == NULL)
+        return EXIT_FAILURE;
+    runs_p->ends = ends;
+    runs_p->ends[runs_p->count++] = runs_p->written;
+    runs_p->numEntries = runs_p->used = 0;
+    return EXIT_SUCCESS;
+}
+
+static int AddToRun (const recordView *record_p, void *arg_p) {
+    runs  *runs_p = arg_p;
+    size_t size = RECORD_HEADER + record_p->length + 1;
+
+    if ((runs_p->used + size > runs_p->size ||
+         runs_p->numEntries == runs_p->maxEntries) &&
+        WriteRun(runs_p) != EXIT_SUCCESS) {
+        runs_p->failed = TRUE;
+        return EXIT_FAILURE;
+    }
+    runs_p->entries[runs_p->numEntries].number = record_p->number;
+    runs_p->entries[runs_p->numEntries++].offset = runs_p->used;
+    runs_p->used += PutRecord(runs_p->arena + runs_p->used, record_p->number,
+                              record_p->theString, record_p->length);
+    return EXIT_SUCCESS;
+}
+
+/* Buffered sequential reader of one run */
+typedef struct runReader_{
+    off_t           next, end;             /* Bytes still in the file    */
+    unsigned char * buffer;
+    size_t          head, tail;            /* Bytes still in the buffer  */
+    recordView      record;                /* Current record             */
+}runReader;
+
+/* Move to the next record of a run, FALSE at its end */
+static int NextInRun (int fd, runReader *reader_p, size_t size) {
+    size_t  left = reader_p->tail - reader_p->head;
+    ssize_t n;
+
+    if (left < RECORD_HEADER ||
+        left < RECORD_HEADER + Get16(reader_p->buffer + reader_p->head + 4)
+               + 1) {
+        if (reader_p->next == reader_p->end && left == 0)
+            return FALSE;
+        memmove(reader_p->buffer, reader_p->buffer + reader_p->head, left);
+        n = size - left;
+        if (n > reader_p->end - reader_p->next)
+            n = reader_p->end - reader_p->next;
+        if (pread(fd, reader_p->buffer + left, n, reader_p->next) != n)
+            return FALSE;
+        reader_p->next += n;
+        reader_p->head = 0;
+        reader_p->tail = left + n;
+        if (reader_p->tail < RECORD_HEADER)
+            return FALSE;                               /* Truncated run */
+    }
+    reader_p->head += GetRecord(reader_p->buffer + reader_p->head,
+                                &reader_p->record);
+    return TRUE;
+}
+
+/* Heap of readers ordered by number and then by run */
+static inline int Before (runReader *readers, long a, long b) {
+    if (readers[a].record.number != readers[b].record.number)
+        return readers[a].record.number < readers[b].record.number;
+    return a < b;
+}
+
+static void SiftDown (runReader *readers, long *heap, long n, long i) {
+    long child, top = heap[i];
+
+    while ((child = 2 * i + 1) < n) {
+        if (child + 1 < n && Before(readers, heap[child + 1], heap[child]))
+            child++;
+        if (!Before(readers, heap[child], top))
+            break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = top;
+}
+
+/*
+ * Merge every run into the list. The buffers of the readers come from the
+ * lent memory when it is large enough, and the list is only emptied once
+ * all of them are ready.
+ */
+static int MergeRuns (diskList *disk_p, runs *runs_p, unsigned char *work,
+                      size_t workSize) {
+    int        fd = fileno(runs_p->file);
+    runReader *readers = calloc(runs_p->count, sizeof(runReader));
+    long      *heap = malloc(runs_p->count * sizeof(long));
+    size_t     size = workSize / runs_p->count;
+    int        lent = size >= 2 * DISK_PAGESIZE;
+    long       r, n = 0;
+    int        result = EXIT_FAILURE;
+
+    if (!lent)
+        size = 2 * DISK_PAGESIZE;
+    if (readers == NULL || heap == NULL)
+        goto done;
+    for (r = 0; r < runs_p->count; r++) {
+        readers[r].next = r == 0 ? 0 : runs_p->ends[r - 1];
+        readers[r].end = runs_p->ends[r];
+        readers[r].buffer = lent ? work + r * size : malloc(size);
+        if (readers[r].buffer == NULL)
+            goto done;
+        if (NextInRun(fd, &readers[r], size))
+            heap[n++] = r;
+    }
+    for (r = n / 2 - 1; r >= 0; r--)
+        SiftDown(readers, heap, n, r);
+
+    /* The list is rewritten from the start */
+    DropPages(disk_p);
+    disk_p->pages = disk_p->records = 0;
+    if (ftruncate(disk_p->fd, 0) != 0)
+        goto done;
+
+    while (n > 0) {
+        r = heap[0];
+        if (AppendRecord(disk_p, readers[r].record.number,
+                         readers[r].record.theString,
+                         readers[r].record.length) != EXIT_SUCCESS)
+            goto done;
+        if (!NextInRun(fd, &readers[r], size))
+            heap[0] = heap[--n];                       /* Run finished */
+        SiftDown(readers, heap, n, 0);
+    }
+    result = FlushDiskList(disk_p);
+
+done:
+    if (readers != NULL && !lent)
+        for (r = 0; r < runs_p->count; r++)
+            free(readers[r].buffer);
+    free(readers);
+    free(heap);
+    return result;
+}
+
+/**
+ * @brief Sort the list by number with an external merge sort.
+ */
+int SortDiskList (diskList *disk_p) {
+    runs           runs_s = {0};
+    long           numFrames = disk_p->numFrames;
+    unsigned char *work = disk_p->memory + DISK_MINPAGES * DISK_PAGESIZE;
+    size_t         workSize = (numFrames - DISK_MINPAGES) * DISK_PAGESIZE;
+    int            lent = workSize >= 4 * DISK_PAGESIZE;
+    int            result = EXIT_FAILURE;
+
+    if (disk_p->records < 2)
+        return EXIT_SUCCESS;
+    if (FlushDiskList(disk_p) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+
+    /*
+     * Reading and writing the list in order only needs DISK_MINPAGES
+     * frames, so the memory of the others is lent to the sort: first to
+     * the runs, half for their records and half for their entries, and
+     * then to the readers of the merge.
+     */
+    DropPages(disk_p);
+    disk_p->numFrames = DISK_MINPAGES;
+    runs_s.size = lent ? workSize / 2 : 2 * DISK_PAGESIZE;
+    runs_s.maxEntries = (lent ? workSize - runs_s.size : runs_s.size)
+                        / sizeof(runEntry);
+    runs_s.file = tmpfile();
+    runs_s.arena = lent ? work : malloc(runs_s.size);
+    runs_s.entries = lent ? (runEntry *)(work + runs_s.size) :
+                     malloc(runs_s.maxEntries * sizeof(runEntry));
+    if (runs_s.file == NULL || runs_s.arena == NULL || runs_s.entries == NULL)
+        goto done;
+
+    /* Phase 1: sorted runs */
+    if (DiskRecords(disk_p, AddToRun, &runs_s) != disk_p->records ||
+        runs_s.failed || WriteRun(&runs_s) != EXIT_SUCCESS ||
+        fflush(runs_s.file) != 0)
+        goto done;
+    if (!lent) {
+        free(runs_s.arena);
+        free(runs_s.entries);
+    }
+    runs_s.arena = NULL;
+    runs_s.entries = NULL;
+
+    /* Phase 2: merge them into the list */
+    result = MergeRuns(disk_p, &runs_s, work, workSize);
+
+done:
+    disk_p->numFrames = numFrames;                  /* Frames given back */
+    if (runs_s.file != NULL)
+        fclose(runs_s.file);
+    free(runs_s.ends);
+    if (!lent) {
+        free(runs_s.arena);
+        free(runs_s.entries);
+    }
+    return result;
+}
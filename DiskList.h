@@ -0,0 +1,208 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    DiskList.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 22:30 CST
+ *
+ * @brief   Declares a list of @c myData records kept in a file instead of
+ *          the heap, for node files larger than the memory of the machine.
+ *          Records are stored in fixed-size pages and only a few pages,
+ *          chosen by a memory budget, are kept in memory.
+ *
+ * References:
+ *          H. Garcia-Molina, J. D. Ullman and J. Widom, "Database Systems:
+ *          The Complete Book", 2nd ed., 2008 (buffer management and the
+ *          two-phase multiway merge sort).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 22:30 CST -- File created
+ *          Mon 19 Oct 2026 04:50 CST -- The sort stays within the budget
+ *
+ * @note    Pages are read and written with pread() and pwrite(). The pages
+ *          in memory are replaced in least recently used order, and a
+ *          changed page is only written when it is replaced or the list is
+ *          flushed.
+ *
+ * @warning A record must fit in a page: its string can have at most
+ *          @c DISK_MAXSTRING characters.
+ *
+ */
+
+#ifndef DISKLIST_H
+#define DISKLIST_H
+
+#include <stddef.h>
+#include "RecordStream.h"
+
+/** @def  DISK_PAGESIZE
+ * @brief Size in bytes of a page, in the file and in memory.
+ */
+#define DISK_PAGESIZE 4096
+
+/** @def  DISK_MINPAGES
+ * @brief Fewest pages kept in memory, whatever the memory budget.
+ */
+#define DISK_MINPAGES 4
+
+/** @def  DISK_MAXSTRING
+ * @brief Longest string that fits in a page with its record header.
+ */
+#define DISK_MAXSTRING (DISK_PAGESIZE - 4 - 6 - 1)
+
+/**
+ * @typedef diskList
+ *
+ * @brief Opaque disk-backed list.
+ */
+typedef struct diskList_ diskList;
+
+/**
+ * @struct diskStats
+ *
+ * @brief Page cache counters of a disk-backed list.
+ */
+typedef struct diskStats_{
+    unsigned long hits;          /**< page accesses found in memory       */
+    unsigned long misses;        /**< page accesses that needed a frame   */
+    unsigned long reads;         /**< pages read from the file            */
+    unsigned long writes;        /**< pages written to the file           */
+    long          pages;         /**< pages in the file                   */
+    long          frames;        /**< pages that fit in memory            */
+}diskStats;
+
+/**
+ *
+ * @brief Create an empty disk-backed list.
+ *
+ * @param  path name of the file that holds the records, it is created or
+ *         truncated. If it is NULL an anonymous temporary file is used,
+ *         which is removed when the list is closed.
+ * @param  memoryBudget bytes of memory for the pages kept in memory.
+ *         SortDiskList() borrows most of it for its runs.
+ * @return pointer to the list, or NULL if the file could not be created or
+ *         there is no memory.
+ *
+ * @code
+ *  disk_p = NewDiskList(NULL, 64 << 20);                   // 64 MiB
+ * @endcode
+ *
+ */
+diskList * NewDiskList (const char *path, size_t memoryBudget);
+
+/**
+ *
+ * @brief Write the changed pages and de-allocate a disk-backed list.
+ *
+ */
+void CloseDiskList (diskList *disk_p);
+
+/**
+ *
+ * @brief Write every changed page to the file.
+ *
+ * @return @c EXIT_SUCCESS or @c EXIT_FAILURE if a write failed.
+ *
+ */
+int FlushDiskList (diskList *disk_p);
+
+/**
+ *
+ * @brief Append a record at the end of the list.
+ *
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if the string is longer than
+ *         @c DISK_MAXSTRING or a page could not be read or written.
+ *
+ */
+int DiskAppend (diskList *disk_p, int number, const char *theString);
+
+/**
+ *
+ * @brief Append every remaining record of a stream.
+ *
+ * @b DiskAppendStream() loads a node file without building a list, so it
+ * works for files larger than memory.
+ *
+ * @return number of records appended, or -1 if one could not be.
+ *
+ * @code
+ *  stream_p = OpenRecordStream(fp);
+ *  DiskAppendStream(disk_p, stream_p);
+ *  CloseRecordStream(stream_p);
+ * @endcode
+ *
+ */
+long DiskAppendStream (diskList *disk_p, recordStream *stream_p);
+
+/**
+ *
+ * @brief Number of records in the list.
+ *
+ */
+long DiskLength (const diskList *disk_p);
+
+/**
+ *
+ * @brief Call a visitor for every record of the list, in order.
+ *
+ * @p visit gets views of the records inside the pages in memory, it must
+ * not call any function on the same list.
+ *
+ * @return number of records visited, or -1 if a page could not be read.
+ *
+ */
+long DiskRecords (diskList *disk_p, recordVisitor visit, void *arg_p);
+
+/**
+ *
+ * @brief Find the first record that matches a value.
+ *
+ * @param  disk_p pointer to the list.
+ * @param  value_p pointer to the user-defined data value to match.
+ * @param  key which field to match, as in FindInList().
+ * @param  record_p where the record found is stored, its string is valid
+ *         until the next call to DiskFind() or the list is closed.
+ * @return position of the record, or -1 if none matches.
+ *
+ */
+long DiskFind (diskList *disk_p, const void *value_p, int key,
+               recordView *record_p);
+
+/**
+ *
+ * @brief Sort the list by number with an external merge sort.
+ *
+ * @b SortDiskList() reads the list in runs that fit in the memory budget,
+ * sorts each one and writes it to a temporary file, and then merges all
+ * the runs back into the list. Records with the same number keep their
+ * order, as with g_list_sort(). While it runs, the page cache keeps only
+ * @c DISK_MINPAGES pages and the rest of its memory holds the runs, so
+ * the memory used stays within the budget.
+ *
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if there is no memory or a
+ *         file operation failed. The list is unchanged if it failed before
+ *         the merge started writing it.
+ *
+ */
+int SortDiskList (diskList *disk_p);
+
+/**
+ *
+ * @brief Print every record in the same format as PrintItem().
+ *
+ * @return @c EXIT_SUCCESS if the list was printed, @c EXIT_FAILURE if it
+ *         is empty or could not be read.
+ *
+ */
+int PrintDiskList (diskList *disk_p);
+
+/**
+ *
+ * @brief Get the page cache counters.
+ *
+ */
+void DiskListStats (const diskList *disk_p, diskStats *stats_p);
+
+#endif
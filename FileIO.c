@@ -29,6 +29,12 @@
  *          May 16 09:14 2016 - Changed function documentation
  *                              to support Doxygen.
  *
+ *          Oct 18 10:12 2026 - Added optional byte, token and latency
+ *                              counters (compile with -DSTATS).
+ *
+ *          Oct 18 19:05 2026 - GetString grows its buffer instead of
+ *                              silently truncating strings at BUFSIZE.
+ *
  * @note    Support routine that reads an ASCII file and returns an
  *          integer value skiping over non-numeric data.
  *
@@ -37,9 +43,12 @@
 #include <stdlib.h>              /* Used for getc() and feof() functions */
 #include <ctype.h>                    /* Used for the isdigit() function */
 #include <stdio.h>                       /* Used to handle the FILE type */
-#include <string.h>                                /* Used for strdup() */
 #include <assert.h>                       /* Used for the asser function */
 #include "FileIO.h"                                   /* Function header */
+#include "Stats.h"                  /* Optional instrumentation counters */
+
+/* Read the next character and count it as parsed */
+#define NEXTCHAR(fp) (bytes++, getc (fp))
 
 /**
  *
@@ -63,25 +72,29 @@
 int GetInt (FILE *fp) {
     int	c,i;		 /* Character read and integer representation of it */
     int sign = 1;
+    unsigned long bytes = 0;     /* Characters consumed, used with -DSTATS */
+    STATS_TIMER(start);
 
     do {
-        c = getc (fp); 	                           /* Get next character */
+        c = NEXTCHAR (fp);                         /* Get next character */
         if ( c == '#' )	                             /* Skip the comment */
             do {
-                c = getc (fp);
+                c = NEXTCHAR (fp);
             } while ( c != '\n');
         if ( c == '-')
             sign = -1;
     } while (!isdigit(c) && !feof(fp));
 
     if (feof(fp)){
+       STATS_ADD(STATS_BYTES_PARSED, bytes);
+       STATS_RECORD(OP_GETINT, start);
        return (EOF);
     } else {
         /* Found 1st digit, begin conversion until a non-digit is found */
         i = 0;
         while (isdigit (c) && !feof(fp)){
             i = (i*10) + (c - '0');
-            c = getc (fp);
+            c = NEXTCHAR (fp);
         }
 
      // If the last line is read, the end of file has not been reached
@@ -90,6 +103,10 @@ int GetInt (FILE *fp) {
          ungetc(c, fp);            // Not the end put it back
       }
 
+        (void)bytes;
+        STATS_ADD(STATS_BYTES_PARSED, bytes);
+        STATS_INC(STATS_TOKENS_PARSED);
+        STATS_RECORD(OP_GETINT, start);
         return (i*sign);
     }
 }
@@ -101,8 +118,8 @@ int GetInt (FILE *fp) {
  *  comments, which begin a line with a #, and other ASCII characters that do
  *  not represent alphabetic characters.
  *
- *  The maximum length of the string is 256 characters. Memory is allocated
- *  by this function and should be freed by the caller.
+ *  The string may have any length, it is not truncated. Memory is
+ *  allocated by this function and should be freed by the caller.
  *
  * @param  fp is a pointer to the input text file to parse.
  *
@@ -116,33 +133,52 @@ int GetInt (FILE *fp) {
  */
 char * GetString (FILE *fp)
 {
-   int	c,i;		           // Character read and index of the buffer
-   char buffer[BUFSIZE];       // Assume maximum length
+   int	c;		           // Character read
+   size_t i, size = BUFSIZE;   // Index and size of the buffer
+   char *buffer, *bigger;      // Grows if the string does not fit
+   unsigned long bytes = 0;    // Characters consumed, used with -DSTATS
+   STATS_TIMER(start);
 
    do 
    {
-      c = getc (fp); 	                           /* Get next character */
+      c = NEXTCHAR (fp);                           /* Get next character */
       if ( c == '#' )	                             /* Skip the comment */
          do 
          {
-            c = getc (fp);
+            c = NEXTCHAR (fp);
          } while ( c != '\n');
    } while (!isalpha(c) && !feof(fp));
 
    if (feof(fp))
    {
+      STATS_ADD(STATS_BYTES_PARSED, bytes);
+      STATS_RECORD(OP_GETSTRING, start);
       return (NULL); /* End of file reached and no string was found */
    } else 
    {
       /* Found 1st character, begin conversion until a digit is found */
+      buffer = malloc(size);
+      if (buffer == NULL)
+         return (NULL);
       i = 0;
-      while (isalpha (c) && !feof(fp) && (i < BUFSIZE))
+      while (isalpha (c) && !feof(fp))
       {
+         if (i + 1 == size)              /* Keep room for the terminator */
+         {
+            bigger = realloc(buffer, 2 * size);
+            if (bigger == NULL)
+            {
+               free(buffer);
+               return (NULL);
+            }
+            buffer = bigger;
+            size *= 2;
+         }
          buffer[i] = (char) c;
          i++;
-         c = getc (fp);
+         c = NEXTCHAR (fp);
       }
-      buffer[i] = '\0';             /* Note how string may be truncated */
+      buffer[i] = '\0';
 
       // If the last line is read, the end of file has not been reached
       c = getc (fp);               // See if it was the last line
@@ -151,8 +187,14 @@ char * GetString (FILE *fp)
          ungetc(c, fp);            // Not the end put it back
       }
 
-      // Now make a copy fo the buffer and make it into a string
-      return strdup(buffer);
+      (void)bytes;
+      STATS_ADD(STATS_BYTES_PARSED, bytes);
+      STATS_INC(STATS_TOKENS_PARSED);
+      STATS_RECORD(OP_GETSTRING, start);
+
+      // Give back the memory the string does not use
+      bigger = realloc(buffer, i + 1);
+      return (bigger != NULL) ? bigger : buffer;
    }
 }
 
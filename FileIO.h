@@ -29,12 +29,15 @@
  *          May 16 09:14 2016 - Changed function documentation
  *                              to support Doxygen.
  *
+ *          Oct 18 19:05 2026 - GetString no longer truncates long
+ *                              strings, BUFSIZE is only the initial size.
+ *
  * @note    Support routine that reads an ASCII file and returns an
  *          integer value skiping over non-numeric data.
  *
  */
 
-#define BUFSIZE 256   // Buffer size for string management
+#define BUFSIZE 256   // Initial buffer size for string management
 
 /**
  *
@@ -64,8 +67,8 @@ int GetInt (FILE *fp);
  *  comments, which begin a line with a #, and other ASCII characters that do
  *  not represent alphabetic characters.
  *
- *  The maximum length of the string is 256 characters. Memory is allocated
- *  by this function and should be freed by the caller.
+ *  The string may have any length, it is not truncated. Memory is
+ *  allocated by this function and should be freed by the caller.
  *
  * @param  fp is a pointer to the input text file to parse.
  *
@@ -0,0 +1,570 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Journal.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 23:15 CST
+ *
+ * @brief   Implements the write-ahead journal of a list: the binary log of
+ *          operations, the snapshot and the recovery.
+ *
+ * References:
+ *          CRC-32 of ISO 3309 / ITU-T V.42, as used by zlib.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 23:15 CST -- File created
+ *          Mon 19 Oct 2026 04:20 CST -- The directory is synced after the
+ *                                       new snapshot is renamed
+ *          Mon 19 Oct 2026 06:20 CST -- The CRC of the snapshot covers its
+ *                                       generation and count, and a lost
+ *                                       record forces a compaction
+ *
+ * @note    Both files start with a magic string and a generation number.
+ *          A compaction writes the snapshot of the next generation and
+ *          then starts a new log of that generation, so a log whose
+ *          generation does not match the snapshot is left over from a
+ *          compaction that was interrupted, and is already included in the
+ *          snapshot.
+ *
+ *          A log record is its size and CRC (32 bits each) followed by the
+ *          operation (8 bits), the number and the position (32 bits each),
+ *          the length of the string (32 bits) and the string with its
+ *          terminator. A snapshot record is the number, the length and the
+ *          string, and the snapshot ends with the CRC of its generation,
+ *          its count of records and all its records.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <stdio.h>                      /* Used for fopen() & rename() */
+#include <string.h>                       /* Used for memcpy & strlen */
+#include <stdint.h>                       /* Used for the record fields */
+#include <fcntl.h>                                     /* Used for open */
+#include <unistd.h>            /* Used for pread, pwrite, fsync & close */
+#include <sys/stat.h>                     /* Used for the size of files */
+#include <glib.h>                   /* Used for the doubly-linked lists */
+#include "Journal.h"                                  /* Function header */
+
+#define HEADER_SIZE   16                   /* magic and generation       */
+#define LOG_HEADER    8                    /* size and CRC of a record   */
+#define OP_SIZE       13                   /* op, number, position, len  */
+
+static const char logMagic[8]  = "NODELOG1";
+static const char snapMagic[8] = "NODESNP1";
+
+/* Operations recorded in the log */
+enum journalOp {OP_APPEND = 1, OP_PREPEND, OP_INSERT, OP_REMOVE};
+
+struct journal_{
+    char          * snapPath;
+    char          * tempPath;              /* New snapshot being written */
+    char          * dirPath;               /* Directory of both files    */
+    int             log;                   /* File descriptor of the log */
+    uint64_t        generation;
+    size_t          logBytes;              /* Committed size of the log  */
+    size_t          compactAt;
+    unsigned char * buffer;                /* Operations not committed   */
+    size_t          used;
+    size_t          size;
+    long            replayed;
+    int             failed;                /* A commit could not write   */
+    int             lost;                  /* The log misses a record    */
+};
+
+static uint32_t crcTable[256];
+
+static void CrcInit (void) {
+    uint32_t c;
+    int      n, k;
+
+    if (crcTable[1] != 0)
+        return;
+    for (n = 0; n < 256; n++) {
+        for (c = n, k = 0; k < 8; k++)
+            c = c & 1 ? 0xEDB88320u ^ (c >> 1) : c >> 1;
+        crcTable[n] = c;
+    }
+}
+
+static uint32_t Crc (uint32_t crc, const unsigned char *p, size_t size) {
+    crc = ~crc;
+    while (size-- > 0)
+        crc = crcTable[(crc ^ *p++) & 0xFF] ^ (crc >> 8);
+    return ~crc;
+}
+
+/* Unaligned fields of the records */
+static inline uint32_t Get32 (const unsigned char *p) {
+    uint32_t value;
+
+    memcpy(&value, p, sizeof(value));
+    return value;
+}
+
+static inline void Put32 (unsigned char *p, uint32_t value) {
+    memcpy(p, &value, sizeof(value));
+}
+
+/* Write all the bytes at an offset, or fail */
+static int WriteAt (int fd, const void *data_p, size_t size, off_t offset) {
+    ssize_t done;
+
+    while (size > 0) {
+        done = pwrite(fd, data_p, size, offset);
+        if (done <= 0)
+            return EXIT_FAILURE;
+        data_p = (const char *)data_p + done;
+        size -= done;
+        offset += done;
+    }
+    return EXIT_SUCCESS;
+}
+
+/* Start an empty log of the current generation */
+static int ResetLog (journal *journal_p) {
+    unsigned char header[HEADER_SIZE];
+
+    memcpy(header, logMagic, sizeof(logMagic));
+    memcpy(header + 8, &journal_p->generation, 8);
+    if (ftruncate(journal_p->log, 0) != 0 ||
+        WriteAt(journal_p->log, header, HEADER_SIZE, 0) != EXIT_SUCCESS ||
+        fdatasync(journal_p->log) != 0)
+        return EXIT_FAILURE;
+    journal_p->logBytes = HEADER_SIZE;
+    return EXIT_SUCCESS;
+}
+
+/* Make the renames in the directory of the journal durable */
+static int SyncDirectory (journal *journal_p) {
+    int fd = open(journal_p->dirPath, O_RDONLY | O_DIRECTORY);
+    int result;
+
+    if (fd < 0)
+        return EXIT_FAILURE;
+    result = fsync(fd) == 0 ? EXIT_SUCCESS : EXIT_FAILURE;
+    close(fd);
+    return result;
+}
+
+/* Read a whole file, returns NULL if it does not exist or is unreadable */
+static unsigned char * ReadFile (int fd, size_t *size_p) {
+    unsigned char *data;
+    struct stat    info;
+    ssize_t        done;
+    size_t         got = 0;
+
+    if (fstat(fd, &info) != 0)
+        return NULL;
+    data = malloc(info.st_size + 1);
+    if (data == NULL)
+        return NULL;
+    while (got < (size_t)info.st_size) {
+        done = read(fd, data + got, info.st_size - got);
+        if (done <= 0)
+            break;
+        got += done;
+    }
+    *size_p = got;
+    return data;
+}
+
+/* Load the snapshot, an absent one is an empty list of generation 0 */
+static int LoadSnapshot (journal *journal_p, GList **myList_pp) {
+    unsigned char *data, *p, *end;
+    GList         *theList_p = NULL;
+    uint64_t       count, i;
+    uint32_t       length;
+    size_t         size;
+    int            fd;
+
+    *myList_pp = NULL;
+    journal_p->generation = 0;
+    fd = open(journal_p->snapPath, O_RDONLY);
+    if (fd < 0)
+        return EXIT_SUCCESS;
+    data = ReadFile(fd, &size);
+    close(fd);
+    if (data == NULL || size < HEADER_SIZE + 8 + 4 ||
+        memcmp(data, snapMagic, sizeof(snapMagic)) != 0)
+        goto damaged;
+
+    memcpy(&journal_p->generation, data + 8, 8);
+    memcpy(&count, data + HEADER_SIZE, 8);
+    end = data + size - 4;
+    if (Crc(0, data + 8, end - data - 8) != Get32(end))
+        goto damaged;
+
+    p = data + HEADER_SIZE + 8;
+    for (i = 0; i < count; i++) {
+        if (end - p < 8)
+            goto damaged;
+        length = Get32(p + 4);
+        if ((size_t)(end - p - 8) <= length || p[8 + length] != '\0')
+            goto damaged;
+        theList_p = g_list_prepend(theList_p,
+                                   NewItem((int)Get32(p), (char *)p + 8));
+        p += 8 + length + 1;
+    }
+    if (p != end)                        /* Records beyond the count */
+        goto damaged;
+    free(data);
+    *myList_pp = g_list_reverse(theList_p);
+    return EXIT_SUCCESS;
+
+damaged:
+    free(data);
+    DestroyList(theList_p);
+    g_list_free(theList_p);
+    return EXIT_FAILURE;
+}
+
+/* Apply one log record to the list, tail_pp and length_p follow it */
+static int Replay (const unsigned char *body, size_t size, GList **list_pp,
+                   GList **tail_pp, long *length_p) {
+    GList   *link_p;
+    uint32_t position = Get32(body + 5), length = Get32(body + 9);
+    int      number = (int)Get32(body + 1);
+    char    *theString = (char *)body + OP_SIZE;
+    int      op;
+
+    if (body[0] != OP_REMOVE &&
+        (size != OP_SIZE + (size_t)length + 1 || theString[length] != '\0'))
+        return EXIT_FAILURE;
+
+    op = body[0];
+    if (op == OP_INSERT && position == (uint32_t)*length_p)
+        op = OP_APPEND;                  /* Inserting at the end appends */
+
+    switch (op) {
+    case OP_INSERT:
+        if (position > (uint32_t)*length_p)
+            return EXIT_FAILURE;
+        link_p = g_list_nth(*list_pp, position);
+        *list_pp = g_list_insert_before(*list_pp, link_p,
+                                        NewItem(number, theString));
+        break;
+    case OP_APPEND:
+        link_p = g_list_append(*tail_pp, NewItem(number, theString));
+        if (*tail_pp == NULL)
+            *list_pp = *tail_pp = link_p;
+        else
+            *tail_pp = (*tail_pp)->next;
+        break;
+    case OP_PREPEND:
+        *list_pp = g_list_prepend(*list_pp, NewItem(number, theString));
+        if (*tail_pp == NULL)
+            *tail_pp = *list_pp;
+        break;
+    case OP_REMOVE:
+        if (position >= (uint32_t)*length_p)
+            return EXIT_FAILURE;
+        link_p = g_list_nth(*list_pp, position);
+        if (link_p == *tail_pp)
+            *tail_pp = link_p->prev;
+        *list_pp = RemoveFromList(*list_pp, link_p);
+        --*length_p;
+        return EXIT_SUCCESS;
+    default:
+        return EXIT_FAILURE;
+    }
+    ++*length_p;
+    return EXIT_SUCCESS;
+}
+
+/* Replay the log on the list, truncating it after the last good record */
+static int ReplayLog (journal *journal_p, GList **myList_pp) {
+    unsigned char *data, *p, *end;
+    GList         *tail_p = g_list_last(*myList_pp);
+    long           length = g_list_length(*myList_pp);
+    uint32_t       size;
+    size_t         total;
+
+    data = ReadFile(journal_p->log, &total);
+    if (data == NULL)
+        return EXIT_FAILURE;
+    if (total < HEADER_SIZE || memcmp(data, logMagic, 8) != 0 ||
+        memcmp(data + 8, &journal_p->generation, 8) != 0) {
+        free(data);                     /* Empty, damaged or already in */
+        return ResetLog(journal_p);    /* the snapshot                 */
+    }
+
+    end = data + total;
+    for (p = data + HEADER_SIZE; end - p >= LOG_HEADER;
+         p += LOG_HEADER + size) {
+        size = Get32(p);
+        if (size < OP_SIZE || (size_t)(end - p - LOG_HEADER) < size ||
+            Crc(0, p + LOG_HEADER, size) != Get32(p + 4) ||
+            Replay(p + LOG_HEADER, size, myList_pp, &tail_p, &length)
+            != EXIT_SUCCESS)
+            break;                                   /* Torn or damaged */
+        journal_p->replayed++;
+    }
+
+    journal_p->logBytes = p - data;
+    free(data);
+    if (journal_p->logBytes < total &&
+        ftruncate(journal_p->log, journal_p->logBytes) != 0)
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
+
+/* Add a record to the buffer and commit or compact if it is time, the
+ * operation must already be applied to myList_p */
+static void Record (journal *journal_p, GList *myList_p, int op, int number,
+                    long position, const char *theString) {
+    size_t         length = theString != NULL ? strlen(theString) : 0;
+    size_t         size = OP_SIZE + (theString != NULL ? length + 1 : 0);
+    unsigned char *p;
+
+    if (!journal_p->lost &&
+        journal_p->used + LOG_HEADER + size > journal_p->size) {
+        p = realloc(journal_p->buffer,
+                    journal_p->used + LOG_HEADER + size + JOURNAL_BATCH);
+        if (p == NULL) {
+            journal_p->lost = TRUE;
+        } else {
+            journal_p->buffer = p;
+            journal_p->size = journal_p->used + LOG_HEADER + size +
+                              JOURNAL_BATCH;
+        }
+    }
+    /*
+     * Once a record is lost the positions of the next ones would refer to
+     * a different list on replay, so nothing more is logged until a new
+     * snapshot of the list, which includes this operation, is saved.
+     */
+    if (journal_p->lost) {
+        if (CompactJournal(journal_p, myList_p) == EXIT_SUCCESS)
+            journal_p->lost = FALSE;
+        return;
+    }
+
+    p = journal_p->buffer + journal_p->used;
+    p[LOG_HEADER] = op;
+    Put32(p + LOG_HEADER + 1, (uint32_t)number);
+    Put32(p + LOG_HEADER + 5, (uint32_t)position);
+    Put32(p + LOG_HEADER + 9, length);
+    if (theString != NULL)
+        memcpy(p + LOG_HEADER + OP_SIZE, theString, length + 1);
+    Put32(p, size);
+    Put32(p + 4, Crc(0, p + LOG_HEADER, size));
+    journal_p->used += LOG_HEADER + size;
+
+    if (journal_p->used >= JOURNAL_BATCH)
+        JournalCommit(journal_p);
+    if (journal_p->compactAt > 0 &&
+        journal_p->logBytes + journal_p->used >= journal_p->compactAt)
+        CompactJournal(journal_p, myList_p);
+}
+
+/**
+ * @brief Recover a list from its journal and keep recording its changes.
+ */
+journal * OpenJournal (const char *path, size_t compactBytes,
+                       GList **myList_pp) {
+    journal *journal_p = calloc(1, sizeof(journal));
+    size_t   length = strlen(path);
+    char    *logPath = malloc(length + 5);
+    char    *separator;
+
+    *myList_pp = NULL;
+    CrcInit();
+    if (journal_p == NULL || logPath == NULL)
+        goto failed;
+    journal_p->log = -1;
+    journal_p->compactAt = compactBytes;
+    journal_p->snapPath = malloc(length + 6);
+    journal_p->tempPath = malloc(length + 10);
+    journal_p->dirPath = malloc(length + 2);
+    if (journal_p->snapPath == NULL || journal_p->tempPath == NULL ||
+        journal_p->dirPath == NULL)
+        goto failed;
+    sprintf(logPath, "%s.log", path);
+    sprintf(journal_p->snapPath, "%s.snap", path);
+    sprintf(journal_p->tempPath, "%s.snap.new", path);
+    strcpy(journal_p->dirPath, path);
+    separator = strrchr(journal_p->dirPath, '/');
+    if (separator == NULL)
+        strcpy(journal_p->dirPath, ".");
+    else
+        separator[separator == journal_p->dirPath ? 1 : 0] = '\0';
+
+    journal_p->log = open(logPath, O_RDWR | O_CREAT, 0644);
+    if (journal_p->log < 0 ||
+        LoadSnapshot(journal_p, myList_pp) != EXIT_SUCCESS ||
+        ReplayLog(journal_p, myList_pp) != EXIT_SUCCESS)
+        goto failed;
+    free(logPath);
+    return journal_p;
+
+failed:
+    DestroyList(*myList_pp);
+    g_list_free(*myList_pp);
+    *myList_pp = NULL;
+    free(logPath);
+    if (journal_p != NULL) {
+        journal_p->failed = TRUE;
+        CloseJournal(journal_p);
+    }
+    return NULL;
+}
+
+/**
+ * @brief Commit the pending operations and close the journal.
+ */
+int CloseJournal (journal *journal_p) {
+    int result;
+
+    if (journal_p == NULL)
+        return EXIT_FAILURE;
+    if (journal_p->log >= 0)
+        JournalCommit(journal_p);
+    result = journal_p->failed || journal_p->lost ? EXIT_FAILURE
+                                                  : EXIT_SUCCESS;
+    if (journal_p->log >= 0)
+        close(journal_p->log);
+    free(journal_p->buffer);
+    free(journal_p->snapPath);
+    free(journal_p->tempPath);
+    free(journal_p->dirPath);
+    free(journal_p);
+    return result;
+}
+
+/**
+ * @brief Write the pending operations to the log and sync it to disk.
+ */
+int JournalCommit (journal *journal_p) {
+    if (journal_p->used == 0)
+        return EXIT_SUCCESS;
+    if (WriteAt(journal_p->log, journal_p->buffer, journal_p->used,
+                journal_p->logBytes) != EXIT_SUCCESS ||
+        fdatasync(journal_p->log) != 0) {
+        journal_p->failed = TRUE;       /* Kept buffered for a later try */
+        return EXIT_FAILURE;
+    }
+    journal_p->logBytes += journal_p->used;
+    journal_p->used = 0;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Save the whole list as the new snapshot and empty the log.
+ */
+int CompactJournal (journal *journal_p, GList *myList_p) {
+    unsigned char  header[HEADER_SIZE + 8], record[8];
+    uint64_t       generation = journal_p->generation + 1;
+    uint64_t       count = g_list_length(myList_p);
+    uint32_t       crc = 0, length;
+    node_p         item_p;
+    FILE          *fp = fopen(journal_p->tempPath, "wb");
+    int            ok;
+
+    if (fp == NULL)
+        return EXIT_FAILURE;
+    setvbuf(fp, NULL, _IOFBF, JOURNAL_BATCH);
+    memcpy(header, snapMagic, sizeof(snapMagic));
+    memcpy(header + 8, &generation, 8);
+    memcpy(header + HEADER_SIZE, &count, 8);
+    crc = Crc(crc, header + 8, sizeof(header) - 8);
+    ok = fwrite(header, sizeof(header), 1, fp) == 1;
+
+    for (; ok && myList_p != NULL; myList_p = myList_p->next) {
+        item_p = myList_p->data;
+        length = strlen(item_p->theString);
+        Put32(record, (uint32_t)item_p->number);
+        Put32(record + 4, length);
+        crc = Crc(crc, record, sizeof(record));
+        crc = Crc(crc, (unsigned char *)item_p->theString, length + 1);
+        ok = fwrite(record, sizeof(record), 1, fp) == 1 &&
+             fwrite(item_p->theString, length + 1, 1, fp) == 1;
+    }
+    Put32(record, crc);
+    ok = ok && fwrite(record, 4, 1, fp) == 1 && fflush(fp) == 0 &&
+         fsync(fileno(fp)) == 0;
+    ok = fclose(fp) == 0 && ok;
+    if (!ok || rename(journal_p->tempPath, journal_p->snapPath) != 0) {
+        remove(journal_p->tempPath);
+        return EXIT_FAILURE;
+    }
+    /*
+     * The rename must be on disk before the log is emptied, otherwise a
+     * crash could leave the old snapshot with the empty log of the new
+     * generation. If it can't be synced the log is left as it is and the
+     * journal is marked as failed.
+     */
+    if (SyncDirectory(journal_p) != EXIT_SUCCESS) {
+        journal_p->failed = TRUE;
+        return EXIT_FAILURE;
+    }
+
+    /* The pending operations are in the snapshot */
+    journal_p->generation = generation;
+    journal_p->used = 0;
+    if (ResetLog(journal_p) != EXIT_SUCCESS) {
+        journal_p->failed = TRUE;
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Append a new item at the end of a list and record it.
+ */
+GList * JournalAppend (journal *journal_p, GList *myList_p, int number,
+                       char *theString) {
+    myList_p = g_list_append(myList_p, NewItem(number, theString));
+    Record(journal_p, myList_p, OP_APPEND, number, 0, theString);
+    return myList_p;
+}
+
+/**
+ * @brief Add a new item at the start of a list and record it.
+ */
+GList * JournalPrepend (journal *journal_p, GList *myList_p, int number,
+                        char *theString) {
+    myList_p = g_list_prepend(myList_p, NewItem(number, theString));
+    Record(journal_p, myList_p, OP_PREPEND, number, 0, theString);
+    return myList_p;
+}
+
+/**
+ * @brief Insert a new item before an element of a list and record it.
+ */
+GList * JournalInsertBefore (journal *journal_p, GList *myList_p,
+                             GList *sibling_p, int number,
+                             char *theString) {
+    long position;
+
+    if (sibling_p == NULL)
+        return JournalAppend(journal_p, myList_p, number, theString);
+    position = g_list_position(myList_p, sibling_p);
+    myList_p = g_list_insert_before(myList_p, sibling_p,
+                                    NewItem(number, theString));
+    Record(journal_p, myList_p, OP_INSERT, number, position, theString);
+    return myList_p;
+}
+
+/**
+ * @brief Remove an element from a list, as RemoveFromList(), and record
+ * it.
+ */
+GList * JournalRemove (journal *journal_p, GList *myList_p, GList *link_p) {
+    long position;
+
+    if (link_p == NULL)
+        return myList_p;
+    position = g_list_position(myList_p, link_p);
+    myList_p = RemoveFromList(myList_p, link_p);
+    Record(journal_p, myList_p, OP_REMOVE, 0, position, NULL);
+    return myList_p;
+}
+
+/**
+ * @brief Number of operations replayed from the log by OpenJournal().
+ */
+long JournalReplayed (const journal *journal_p) {
+    return journal_p->replayed;
+}
@@ -0,0 +1,178 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Journal.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 23:15 CST
+ *
+ * @brief   Declares a write-ahead journal for lists. Every append,
+ *          prepend, insertion and removal is recorded in a binary log, the
+ *          list is saved now and then as a binary snapshot, and a restart
+ *          loads the snapshot and replays the log instead of parsing the
+ *          node file again.
+ *
+ * References:
+ *          C. Mohan et al., "ARIES: a transaction recovery method...",
+ *          ACM TODS 17(1), 1992 (write-ahead logging, group commit).
+ *          M. Rosenblum and J. K. Ousterhout, "The design and
+ *          implementation of a log-structured file system", ACM TOCS
+ *          10(1), 1992 (checkpoints).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 23:15 CST -- File created
+ *          Mon 19 Oct 2026 04:20 CST -- A compaction syncs the directory
+ *          Mon 19 Oct 2026 06:20 CST -- A record that can't be buffered
+ *                                       forces a compaction
+ *
+ * @note    The journal uses two files, @c path.snap and @c path.log. Each
+ *          operation is buffered and the buffer is written and synced to
+ *          disk (group commit) when it holds @c JOURNAL_BATCH bytes or
+ *          when JournalCommit() is called. Operations not committed yet
+ *          are lost if the program crashes, the others are not.
+ *
+ * @warning Every change to the list must go through the journal, or the
+ *          positions recorded in the log will not match the list.
+ *
+ */
+
+#ifndef JOURNAL_H
+#define JOURNAL_H
+
+#include <stddef.h>
+#include <glib.h>
+#include "UserDefined.h"
+
+/** @def  JOURNAL_BATCH
+ * @brief Bytes of operations buffered before they are committed.
+ */
+#define JOURNAL_BATCH 65536
+
+/**
+ * @typedef journal
+ *
+ * @brief Opaque journal of a list.
+ */
+typedef struct journal_ journal;
+
+/**
+ *
+ * @brief Recover a list from its journal and keep recording its changes.
+ *
+ * @b OpenJournal() loads the snapshot, if there is one, and replays the
+ * operations in the log that were made after it. A log whose last record
+ * is incomplete or damaged (e.g. by a crash while it was written) is
+ * replayed up to that record and truncated there.
+ *
+ * @param  path name of the journal, without the @c .snap or @c .log
+ *         extension. The files are created if they do not exist.
+ * @param  compactBytes size of the log that triggers a compaction after a
+ *         commit, 0 to compact only when CompactJournal() is called.
+ * @param  myList_pp where the recovered list is stored.
+ * @return pointer to the journal, or NULL if the snapshot is damaged, a
+ *         file could not be opened or there is no memory.
+ *
+ * @code
+ *  journal_p = OpenJournal("nodes", 64 << 20, &theList_p);
+ *  theList_p = JournalAppend(journal_p, theList_p, 13, "Hello");
+ *  CloseJournal(journal_p);
+ * @endcode
+ *
+ */
+journal * OpenJournal (const char *path, size_t compactBytes,
+                       GList **myList_pp);
+
+/**
+ *
+ * @brief Commit the pending operations and close the journal.
+ *
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if the last commit failed
+ *         or an operation could not be recorded and no compaction has
+ *         saved it since.
+ *
+ */
+int CloseJournal (journal *journal_p);
+
+/**
+ *
+ * @brief Write the pending operations to the log and sync it to disk.
+ *
+ * @return @c EXIT_SUCCESS or @c EXIT_FAILURE if the log could not be
+ *         written.
+ *
+ */
+int JournalCommit (journal *journal_p);
+
+/**
+ *
+ * @brief Save the whole list as the new snapshot and empty the log.
+ *
+ * The snapshot is written to a temporary file that replaces the old one
+ * once it is complete, so a crash leaves either the old or the new one.
+ *
+ * @return @c EXIT_SUCCESS or @c EXIT_FAILURE if it could not be written,
+ *         the old snapshot and log are then still valid. It also fails if
+ *         the directory can't be synced after the rename; the snapshot on
+ *         disk may then be the old or the new one, and the operations
+ *         recorded afterwards are only safe once a later compaction
+ *         succeeds.
+ *
+ */
+int CompactJournal (journal *journal_p, GList *myList_p);
+
+/**
+ *
+ * @brief Append a new item at the end of a list and record it.
+ *
+ * If there is no memory to buffer the operation the log is no longer
+ * written, and the whole list is saved with CompactJournal() instead, now
+ * or on the next operation if that fails too. The same holds for the other
+ * operations below.
+ *
+ * @return pointer to the new start of the list.
+ *
+ */
+GList * JournalAppend (journal *journal_p, GList *myList_p, int number,
+                       char *theString);
+
+/**
+ *
+ * @brief Add a new item at the start of a list and record it.
+ *
+ * @return pointer to the new start of the list.
+ *
+ */
+GList * JournalPrepend (journal *journal_p, GList *myList_p, int number,
+                        char *theString);
+
+/**
+ *
+ * @brief Insert a new item before an element of a list and record it.
+ *
+ * @param  sibling_p element to insert before, NULL to append.
+ * @return pointer to the new start of the list.
+ *
+ */
+GList * JournalInsertBefore (journal *journal_p, GList *myList_p,
+                             GList *sibling_p, int number,
+                             char *theString);
+
+/**
+ *
+ * @brief Remove an element from a list, as RemoveFromList(), and record
+ * it.
+ *
+ * @return pointer to the new start of the list.
+ *
+ */
+GList * JournalRemove (journal *journal_p, GList *myList_p, GList *link_p);
+
+/**
+ *
+ * @brief Number of operations replayed from the log by OpenJournal().
+ *
+ */
+long JournalReplayed (const journal *journal_p);
+
+#endif
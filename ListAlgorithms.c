@@ -0,0 +1,233 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    ListAlgorithms.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 13:40 CST
+ *
+ * @brief   Implements algorithms over whole lists of the user-defined data
+ *          structure @c myData.
+ *
+ * References:
+ *          Code based on my own code for the Generic linked lists.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 13:40 CST -- File created, added TopKInList
+ *          Sun 18 Oct 2026 14:15 CST -- Added merge and set operations
+ *                          over sorted lists
+ *
+ * @note    Items are ordered by their @c number field with CompareItems(),
+ *          the same order used with @c g_list_sort().
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <glib.h>                        /* Used for the list functions */
+#include "ListAlgorithms.h"                           /* Function header */
+
+/* Item kept by the top-k heap, the position breaks ties */
+typedef struct heapEntry_{
+    node_p item;
+    long   position;
+}heapEntry;
+
+/*
+ * TRUE if a is a worse candidate than b: it is further from the requested
+ * end of the order or, with the same number, it comes later in the list.
+ */
+static int Worse (const heapEntry *a, const heapEntry *b, int order) {
+    int cmp = CompareItems(a->item, b->item);
+
+    if (cmp == EQUAL)
+        return a->position > b->position;
+    return order == LESS ? cmp == GREATER : cmp == LESS;
+}
+
+/* Restore the heap (worst entry at the root) below index i */
+static void SiftDown (heapEntry *heap, int size, int i, int order) {
+    heapEntry entry = heap[i];
+    int       child;
+
+    while ((child = 2*i + 1) < size) {
+        if (child + 1 < size && Worse(&heap[child + 1], &heap[child], order))
+            child++;
+        if (!Worse(&heap[child], &entry, order))
+            break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = entry;
+}
+
+/* Move entry i up to its place in the heap */
+static void SiftUp (heapEntry *heap, int i, int order) {
+    heapEntry entry = heap[i];
+    int       parent;
+
+    while (i > 0) {
+        parent = (i - 1) / 2;
+        if (!Worse(&entry, &heap[parent], order))
+            break;
+        heap[i] = heap[parent];
+        i = parent;
+    }
+    heap[i] = entry;
+}
+
+/**
+ * @brief Select the k smallest or largest items of a list.
+ */
+GList * TopKInList (GList * myList_p, int k, int order, int copy) {
+    heapEntry * heap;
+    heapEntry   candidate;
+    GList     * l;
+    GList     * theTop_p = NULL;
+    long        position = 0;
+    int         size = 0;
+
+    if (myList_p == NULL || k <= 0)
+        return NULL;
+    heap = malloc(k * sizeof(heapEntry));
+    if (heap == NULL)
+        return NULL;
+
+    for (l = myList_p; l != NULL; l = l->next, position++) {
+        candidate.item = l->data;
+        candidate.position = position;
+        if (size < k) {
+            heap[size] = candidate;
+            SiftUp(heap, size++, order);
+        } else if (Worse(&heap[0], &candidate, order)) {
+            heap[0] = candidate;               /* Replace the worst kept */
+            SiftDown(heap, size, 0, order);
+        }
+    }
+
+    /* Pop the worst entry each time, building the list from its end */
+    while (size > 0) {
+        node_p item = heap[0].item;
+
+        theTop_p = g_list_prepend(theTop_p,
+                                  copy ? NewItem(item->number,
+                                                 item->theString)
+                                       : item);
+        heap[0] = heap[--size];
+        SiftDown(heap, size, 0, order);
+    }
+
+    free(heap);
+    return theTop_p;
+}
+
+/* Operations supported by SetOperation() */
+enum setOp {MERGE, UNION, INTERSECTION, DIFFERENCE};
+
+/* List being built by SetOperation() */
+typedef struct result_{
+    GList * head;
+    GList * tail;
+    int     copy;
+}result;
+
+/* Move the link at *cursor_p (or a copy of it) to the end of the result */
+static void Take (result *result_p, GList **cursor_p) {
+    GList *link = *cursor_p;
+    node_p item = link->data;
+
+    *cursor_p = link->next;
+    if (result_p->copy) {
+        link = g_list_alloc();
+        link->data = NewItem(item->number, item->theString);
+    }
+    link->prev = result_p->tail;
+    link->next = NULL;
+    if (result_p->tail != NULL)
+        result_p->tail->next = link;
+    else
+        result_p->head = link;
+    result_p->tail = link;
+}
+
+/* Skip the link at *cursor_p, freeing it if the inputs are consumed */
+static void Drop (result *result_p, GList **cursor_p) {
+    GList *link = *cursor_p;
+
+    *cursor_p = link->next;
+    if (!result_p->copy) {
+        FreeItem(link->data);
+        g_list_free_1(link);
+    }
+}
+
+/* Single pass over two sorted lists shared by the merge and set functions */
+static GList * SetOperation (GList *a, GList *b, int op, int copy) {
+    result result_s = {NULL, NULL, copy};
+
+    while (a != NULL && b != NULL) {
+        switch (CompareItems(a->data, b->data)) {
+            case LESS:
+                if (op == INTERSECTION)
+                    Drop(&result_s, &a);
+                else
+                    Take(&result_s, &a);
+                break;
+            case GREATER:
+                if (op == MERGE || op == UNION)
+                    Take(&result_s, &b);
+                else
+                    Drop(&result_s, &b);
+                break;
+            default:                                   /* A matching pair */
+                if (op == DIFFERENCE)
+                    Drop(&result_s, &a);
+                else
+                    Take(&result_s, &a);
+                if (op != MERGE)
+                    Drop(&result_s, &b);
+                break;
+        }
+    }
+
+    while (a != NULL)
+        if (op == INTERSECTION)
+            Drop(&result_s, &a);
+        else
+            Take(&result_s, &a);
+    while (b != NULL)
+        if (op == MERGE || op == UNION)
+            Take(&result_s, &b);
+        else
+            Drop(&result_s, &b);
+
+    return result_s.head;
+}
+
+/**
+ * @brief Merge two sorted lists into one sorted list.
+ */
+GList * MergeLists (GList * listA_p, GList * listB_p, int copy) {
+    return SetOperation(listA_p, listB_p, MERGE, copy);
+}
+
+/**
+ * @brief Union of two sorted lists.
+ */
+GList * UnionLists (GList * listA_p, GList * listB_p, int copy) {
+    return SetOperation(listA_p, listB_p, UNION, copy);
+}
+
+/**
+ * @brief Intersection of two sorted lists.
+ */
+GList * IntersectLists (GList * listA_p, GList * listB_p, int copy) {
+    return SetOperation(listA_p, listB_p, INTERSECTION, copy);
+}
+
+/**
+ * @brief Difference of two sorted lists.
+ */
+GList * DifferenceLists (GList * listA_p, GList * listB_p, int copy) {
+    return SetOperation(listA_p, listB_p, DIFFERENCE, copy);
+}
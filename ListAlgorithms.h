@@ -0,0 +1,160 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    ListAlgorithms.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 13:40 CST
+ *
+ * @brief   Declares algorithms over whole lists of the user-defined data
+ *          structure @c myData.
+ *
+ * References:
+ *          Code based on my own code for the Generic linked lists.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 13:40 CST -- File created, added TopKInList
+ *          Sun 18 Oct 2026 14:15 CST -- Added merge and set operations
+ *                          over sorted lists
+ *
+ * @note    Items are ordered by their @c number field with CompareItems(),
+ *          the same order used with @c g_list_sort(). The merge and set
+ *          operations pair items with equal numbers one to one, like the
+ *          algorithms over sorted ranges of the C++ standard library.
+ *
+ */
+
+#ifndef LISTALGORITHMS_H
+#define LISTALGORITHMS_H
+
+#include <glib.h>
+#include "UserDefined.h"
+
+/**
+ *
+ * @brief Select the @p k smallest or largest items of a list.
+ *
+ * @b TopKInList() keeps the best @p k items seen so far in a bounded heap,
+ * so it takes O(n log k) time and only O(k) extra memory. The rest of the
+ * list is neither copied nor sorted.
+ *
+ * @param  myList_p pointer to the list.
+ * @param  k number of items to select.
+ * @param  order @c LESS for the smallest items in ascending order or
+ *         @c GREATER for the largest items in descending order.
+ * @param  copy if @c TRUE the new list holds copies of the items made with
+ *         NewItem() and must be destroyed with DestroyList(). Otherwise it
+ *         points to the same items as @p myList_p and must be freed with
+ *         @c g_list_free().
+ * @return pointer to a new list with at most @p k items, NULL if the list
+ *         is empty, @p k is not positive or there is not enough memory.
+ *         Items with equal numbers keep the order they have in the list.
+ *
+ * @code
+ *  top_p = TopKInList(theList_p, 100, GREATER, FALSE);
+ *  PrintList(top_p);
+ *  g_list_free(top_p);
+ * @endcode
+ *
+ */
+GList * TopKInList (GList * myList_p, int k, int order, int copy);
+
+/**
+ *
+ * @brief Merge two sorted lists into one sorted list.
+ *
+ * @b MergeLists() keeps every item of both lists. Items with equal numbers
+ * keep their relative order, with the items of @p listA_p first.
+ * Runs in a single linear pass.
+ *
+ * @param  listA_p pointer to the first list, sorted by @c number.
+ * @param  listB_p pointer to the second list, sorted by @c number.
+ * @param  copy if @c TRUE both lists are left untouched and the result
+ *         holds copies of the items made with NewItem(). Otherwise both
+ *         lists are consumed: their links are reused by the result and the
+ *         items that are not part of the result are freed, so nothing is
+ *         allocated.
+ * @return pointer to the resulting sorted list.
+ *
+ * @code
+ *  merged_p = MergeLists(today_p, yesterday_p, FALSE);
+ * @endcode
+ *
+ */
+GList * MergeLists (GList * listA_p, GList * listB_p, int copy);
+
+/**
+ *
+ * @brief Union of two sorted lists.
+ *
+ * @b UnionLists() keeps the items of both lists, but an item of @p listB_p
+ * is dropped when it is paired with an item of @p listA_p with the same
+ * number.
+ * Runs in a single linear pass.
+ *
+ * @param  listA_p pointer to the first list, sorted by @c number.
+ * @param  listB_p pointer to the second list, sorted by @c number.
+ * @param  copy if @c TRUE both lists are left untouched and the result
+ *         holds copies of the items made with NewItem(). Otherwise both
+ *         lists are consumed: their links are reused by the result and the
+ *         items that are not part of the result are freed, so nothing is
+ *         allocated.
+ * @return pointer to the resulting sorted list.
+ *
+ * @code
+ *  all_p = UnionLists(today_p, yesterday_p, TRUE);
+ * @endcode
+ *
+ */
+GList * UnionLists (GList * listA_p, GList * listB_p, int copy);
+
+/**
+ *
+ * @brief Intersection of two sorted lists.
+ *
+ * @b IntersectLists() keeps the items of @p listA_p that are paired with
+ * an item of @p listB_p with the same number.
+ * Runs in a single linear pass.
+ *
+ * @param  listA_p pointer to the first list, sorted by @c number.
+ * @param  listB_p pointer to the second list, sorted by @c number.
+ * @param  copy if @c TRUE both lists are left untouched and the result
+ *         holds copies of the items made with NewItem(). Otherwise both
+ *         lists are consumed: their links are reused by the result and the
+ *         items that are not part of the result are freed, so nothing is
+ *         allocated.
+ * @return pointer to the resulting sorted list.
+ *
+ * @code
+ *  common_p = IntersectLists(today_p, yesterday_p, TRUE);
+ * @endcode
+ *
+ */
+GList * IntersectLists (GList * listA_p, GList * listB_p, int copy);
+
+/**
+ *
+ * @brief Difference of two sorted lists.
+ *
+ * @b DifferenceLists() keeps the items of @p listA_p that are not paired
+ * with an item of @p listB_p with the same number.
+ * Runs in a single linear pass.
+ *
+ * @param  listA_p pointer to the first list, sorted by @c number.
+ * @param  listB_p pointer to the second list, sorted by @c number.
+ * @param  copy if @c TRUE both lists are left untouched and the result
+ *         holds copies of the items made with NewItem(). Otherwise both
+ *         lists are consumed: their links are reused by the result and the
+ *         items that are not part of the result are freed, so nothing is
+ *         allocated.
+ * @return pointer to the resulting sorted list.
+ *
+ * @code
+ *  added_p = DifferenceLists(today_p, yesterday_p, TRUE);
+ * @endcode
+ *
+ */
+GList * DifferenceLists (GList * listA_p, GList * listB_p, int copy);
+
+#endif
@@ -0,0 +1,234 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    ListCursor.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 15:30 CST
+ *
+ * @brief   Implements a cursor that remembers a position in a list.
+ *
+ * References:
+ *          Code based on my own code for the Generic linked lists.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 15:30 CST -- File created
+ *          Mon 19 Oct 2026 07:05 CST -- CursorFindNear() prefers the element
+ *                                       after the cursor at every distance,
+ *                                       and the finds record their latency
+ *
+ * @note    Links are inserted and removed by updating the prev and next
+ *          pointers around the cursor, so no operation walks the list.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <glib.h>                        /* Used for the list functions */
+#include "ListCursor.h"                               /* Function header */
+#include "Stats.h"                  /* Optional instrumentation counters */
+
+/**
+ * @brief Allocate a cursor placed on the first element of a list.
+ */
+listCursor * NewCursor (GList ** list_pp) {
+    listCursor *cursor_p;
+
+    if (list_pp == NULL)
+        return NULL;
+    cursor_p = malloc(sizeof(listCursor));
+    if (cursor_p != NULL) {
+        cursor_p->list_pp = list_pp;
+        cursor_p->position = *list_pp;
+    }
+    return cursor_p;
+}
+
+/**
+ * @brief De-allocate a cursor.
+ */
+void FreeCursor (listCursor *cursor_p) {
+    free(cursor_p);
+}
+
+/**
+ * @brief Return the user-defined data under the cursor.
+ */
+node_p CursorItem (const listCursor *cursor_p) {
+    return cursor_p->position != NULL ? cursor_p->position->data : NULL;
+}
+
+/**
+ * @brief Move the cursor to the next element.
+ */
+int CursorNext (listCursor *cursor_p) {
+    if (cursor_p->position == NULL || cursor_p->position->next == NULL)
+        return EXIT_FAILURE;
+    cursor_p->position = cursor_p->position->next;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Move the cursor to the previous element.
+ */
+int CursorPrev (listCursor *cursor_p) {
+    if (cursor_p->position == NULL || cursor_p->position->prev == NULL)
+        return EXIT_FAILURE;
+    cursor_p->position = cursor_p->position->prev;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Move the cursor a number of elements forward or backward.
+ */
+long CursorMove (listCursor *cursor_p, long steps) {
+    long moved = 0;
+
+    while (steps > moved && CursorNext(cursor_p) == EXIT_SUCCESS)
+        moved++;
+    while (steps < -moved && CursorPrev(cursor_p) == EXIT_SUCCESS)
+        moved++;
+    return moved;
+}
+
+/* Link new_p into an empty list and place the cursor on it */
+static int InsertFirst (listCursor *cursor_p, GList *new_p) {
+    *cursor_p->list_pp = new_p;
+    cursor_p->position = new_p;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Insert a new element before the cursor.
+ */
+int CursorInsertBefore (listCursor *cursor_p, node_p item_p) {
+    GList *new_p = g_list_alloc();
+    GList *position = cursor_p->position;
+
+    new_p->data = item_p;
+    if (position == NULL)
+        return InsertFirst(cursor_p, new_p);
+
+    new_p->next = position;
+    new_p->prev = position->prev;
+    if (position->prev != NULL)
+        position->prev->next = new_p;
+    else
+        *cursor_p->list_pp = new_p;                 /* New head */
+    position->prev = new_p;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Insert a new element after the cursor.
+ */
+int CursorInsertAfter (listCursor *cursor_p, node_p item_p) {
+    GList *new_p = g_list_alloc();
+    GList *position = cursor_p->position;
+
+    new_p->data = item_p;
+    if (position == NULL)
+        return InsertFirst(cursor_p, new_p);
+
+    new_p->prev = position;
+    new_p->next = position->next;
+    if (position->next != NULL)
+        position->next->prev = new_p;
+    position->next = new_p;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Remove the element under the cursor and de-allocate its data.
+ */
+int CursorRemove (listCursor *cursor_p) {
+    GList *position = cursor_p->position;
+
+    if (position == NULL)
+        return EXIT_FAILURE;
+    cursor_p->position = position->next != NULL ? position->next
+                                                : position->prev;
+    *cursor_p->list_pp = RemoveFromList(*cursor_p->list_pp, position);
+    return EXIT_SUCCESS;
+}
+
+/* Walk from the cursor in one direction until a match is found */
+static int CursorFind (listCursor *cursor_p, const void *value_p, int key,
+                       int forward) {
+    STATS_TIMER(start);
+    GList         *l;
+    unsigned long  visited = 0;   /* Nodes visited, only reported with -DSTATS */
+
+    for (l = cursor_p->position; l != NULL; l = forward ? l->next : l->prev) {
+        visited++;
+        if (CompareItemsWithKey(l->data, value_p, key) == EQUAL)
+            break;
+    }
+
+    (void)visited;
+    STATS_INC(STATS_FIND_CALLS);
+    STATS_ADD(STATS_FIND_VISITED, visited);
+    STATS_RECORD(OP_FIND, start);
+    if (l == NULL)
+        return EXIT_FAILURE;
+    cursor_p->position = l;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Move the cursor forward to the next element that matches a value.
+ */
+int CursorFindNext (listCursor *cursor_p, const void *value_p, int key) {
+    return CursorFind(cursor_p, value_p, key, TRUE);
+}
+
+/**
+ * @brief Move the cursor backward to the previous element that matches.
+ */
+int CursorFindPrev (listCursor *cursor_p, const void *value_p, int key) {
+    return CursorFind(cursor_p, value_p, key, FALSE);
+}
+
+/**
+ * @brief Move the cursor to the closest element that matches a value.
+ */
+int CursorFindNear (listCursor *cursor_p, const void *value_p, int key) {
+    STATS_TIMER(start);
+    GList         *ahead = cursor_p->position;
+    GList         *behind = NULL, *found = NULL;
+    unsigned long  visited = 0;   /* Nodes visited, only reported with -DSTATS */
+
+    if (ahead != NULL) {                 /* The element under the cursor */
+        visited++;
+        if (CompareItemsWithKey(ahead->data, value_p, key) == EQUAL)
+            found = ahead;
+        behind = ahead->prev;
+        ahead = ahead->next;
+    }
+    /* Both elements at the same distance, the one after the cursor first */
+    while (found == NULL && (ahead != NULL || behind != NULL)) {
+        if (ahead != NULL) {
+            visited++;
+            if (CompareItemsWithKey(ahead->data, value_p, key) == EQUAL) {
+                found = ahead;
+                break;
+            }
+            ahead = ahead->next;
+        }
+        if (behind != NULL) {
+            visited++;
+            if (CompareItemsWithKey(behind->data, value_p, key) == EQUAL)
+                found = behind;
+            behind = behind->prev;
+        }
+    }
+
+    (void)visited;
+    STATS_INC(STATS_FIND_CALLS);
+    STATS_ADD(STATS_FIND_VISITED, visited);
+    STATS_RECORD(OP_FIND, start);
+    if (found == NULL)
+        return EXIT_FAILURE;
+    cursor_p->position = found;
+    return EXIT_SUCCESS;
+}
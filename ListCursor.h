@@ -0,0 +1,198 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    ListCursor.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 15:30 CST
+ *
+ * @brief   Declares a cursor that remembers a position in a list so that
+ *          repeated lookups, insertions and removals near it do not have
+ *          to start again from the head of the list.
+ *
+ * References:
+ *          Code based on my own code for the Generic linked lists.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 15:30 CST -- File created
+ *
+ * @warning Removing the element under a cursor with any other function
+ *          (or another cursor) leaves the cursor dangling.
+ *
+ * @note    The cursor keeps the address of the caller's list pointer, so
+ *          insertions and removals at the head update it.
+ *
+ */
+
+#ifndef LISTCURSOR_H
+#define LISTCURSOR_H
+
+#include <glib.h>
+#include "UserDefined.h"
+
+/**
+ * @struct listCursor
+ *
+ * @brief A position in a list.
+ *
+ * @c position is NULL only when the list is empty.
+ */
+typedef struct listCursor_{
+    GList ** list_pp;           /**< address of the caller's list pointer */
+    GList  * position;          /**< element under the cursor             */
+}listCursor;
+
+/**
+ *
+ * @brief Allocate a cursor placed on the first element of a list.
+ *
+ * @param  list_pp is the address of the pointer to the list.
+ * @return pointer to the new cursor or NULL if there is no memory.
+ *
+ * @code
+ *  cursor_p = NewCursor(&theList_p);
+ * @endcode
+ *
+ */
+listCursor * NewCursor (GList ** list_pp);
+
+/**
+ *
+ * @brief De-allocate a cursor. The list is not modified.
+ *
+ * @param  cursor_p is a pointer to the cursor.
+ *
+ */
+void FreeCursor (listCursor *cursor_p);
+
+/**
+ *
+ * @brief Return the user-defined data under the cursor.
+ *
+ * @return pointer to the data or NULL if the list is empty.
+ *
+ */
+node_p CursorItem (const listCursor *cursor_p);
+
+/**
+ *
+ * @brief Move the cursor to the next element.
+ *
+ * @return @c EXIT_SUCCESS if it moved, @c EXIT_FAILURE if the cursor
+ *         was on the last element (it does not move).
+ *
+ */
+int CursorNext (listCursor *cursor_p);
+
+/**
+ *
+ * @brief Move the cursor to the previous element.
+ *
+ * @return @c EXIT_SUCCESS if it moved, @c EXIT_FAILURE if the cursor
+ *         was on the first element (it does not move).
+ *
+ */
+int CursorPrev (listCursor *cursor_p);
+
+/**
+ *
+ * @brief Move the cursor @p steps elements forward, or backward if
+ * @p steps is negative.
+ *
+ * @return number of elements actually moved, which is smaller than
+ *         @p steps (in absolute value) if an end of the list is reached.
+ *
+ */
+long CursorMove (listCursor *cursor_p, long steps);
+
+/**
+ *
+ * @brief Insert a new element before the cursor. The cursor stays on
+ * the same element.
+ *
+ * @b CursorInsertBefore() takes constant time. If the list was empty the
+ * cursor is placed on the new element.
+ *
+ * @param  cursor_p is a pointer to the cursor.
+ * @param  item_p is the user-defined data of the new element.
+ * @return @c EXIT_SUCCESS if it was inserted, otherwise @c EXIT_FAILURE.
+ *
+ */
+int CursorInsertBefore (listCursor *cursor_p, node_p item_p);
+
+/**
+ *
+ * @brief Insert a new element after the cursor. The cursor stays on the
+ * same element.
+ *
+ * @b CursorInsertAfter() takes constant time. If the list was empty the
+ * cursor is placed on the new element.
+ *
+ * @param  cursor_p is a pointer to the cursor.
+ * @param  item_p is the user-defined data of the new element.
+ * @return @c EXIT_SUCCESS if it was inserted, otherwise @c EXIT_FAILURE.
+ *
+ */
+int CursorInsertAfter (listCursor *cursor_p, node_p item_p);
+
+/**
+ *
+ * @brief Remove the element under the cursor and de-allocate its data.
+ *
+ * @b CursorRemove() takes constant time. The cursor moves to the next
+ * element, or to the previous one if the last element was removed.
+ *
+ * @return @c EXIT_SUCCESS if it was removed, @c EXIT_FAILURE if the list
+ *         is empty.
+ *
+ */
+int CursorRemove (listCursor *cursor_p);
+
+/**
+ *
+ * @brief Move the cursor forward to the next element that matches a
+ * value, starting with the element under the cursor.
+ *
+ * @param  cursor_p is a pointer to the cursor.
+ * @param  value_p pointer to the user-defined data value to match.
+ * @param  key which field to match, as in FindInList().
+ * @return @c EXIT_SUCCESS if a match was found, otherwise
+ *         @c EXIT_FAILURE and the cursor does not move.
+ *
+ * @code
+ *  while (CursorFindNext(cursor_p, &nodeValue, SINGLEINT) == EXIT_SUCCESS)
+ *     if (CursorRemove(cursor_p) != EXIT_SUCCESS)
+ *        break;
+ * @endcode
+ *
+ */
+int CursorFindNext (listCursor *cursor_p, const void *value_p, int key);
+
+/**
+ *
+ * @brief Move the cursor backward to the previous element that matches a
+ * value, starting with the element under the cursor.
+ *
+ * @return @c EXIT_SUCCESS if a match was found, otherwise
+ *         @c EXIT_FAILURE and the cursor does not move.
+ *
+ */
+int CursorFindPrev (listCursor *cursor_p, const void *value_p, int key);
+
+/**
+ *
+ * @brief Move the cursor to the closest element that matches a value,
+ * looking in both directions at the same time.
+ *
+ * @b CursorFindNear() takes time proportional to the distance between
+ * the cursor and the match, which suits clustered updates. On a tie the
+ * element after the cursor wins.
+ *
+ * @return @c EXIT_SUCCESS if a match was found, otherwise
+ *         @c EXIT_FAILURE and the cursor does not move.
+ *
+ */
+int CursorFindNear (listCursor *cursor_p, const void *value_p, int key);
+
+#endif
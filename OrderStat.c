@@ -0,0 +1,360 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    OrderStat.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 01:40 CST
+ *
+ * @brief   Implements the order-statistic list as a treap with implicit
+ *          keys: the key of an element is its position, which is never
+ *          stored but found from the sizes of the subtrees.
+ *
+ * References:
+ *          G. Marsaglia, "Xorshift RNGs", Journal of Statistical Software
+ *          8(14), 2003 (the priorities).
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 01:40 CST -- File created
+ *
+ * @note    Insertions and removals split the tree at a position and merge
+ *          the pieces back. The parent pointers, used by OrderRank() and
+ *          OrderNext(), are fixed by Update() on the way back up.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <glib.h>                   /* Used for the doubly-linked lists */
+#include "OrderStat.h"                                /* Function header */
+
+struct orderList_{
+    orderLink * root;
+    guint32     seed;                      /* State of the priorities    */
+};
+
+static inline long Size (const orderLink *link_p) {
+    return link_p != NULL ? link_p->size : 0;
+}
+
+/* Recompute the size of a node and adopt its children */
+static inline void Update (orderLink *link_p) {
+    link_p->size = 1 + Size(link_p->left) + Size(link_p->right);
+    if (link_p->left != NULL)
+        link_p->left->parent = link_p;
+    if (link_p->right != NULL)
+        link_p->right->parent = link_p;
+}
+
+static guint32 Priority (orderList *order_p) {
+    guint32 x = order_p->seed;
+
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    return order_p->seed = x;
+}
+
+static orderLink * NewLink (orderList *order_p, node_p item_p) {
+    orderLink *link_p = malloc(sizeof(orderLink));
+
+    if (link_p == NULL)
+        return NULL;
+    link_p->data = item_p;
+    link_p->left = link_p->right = link_p->parent = NULL;
+    link_p->size = 1;
+    link_p->priority = Priority(order_p);
+    return link_p;
+}
+
+/* Split a tree into its first count elements and the rest */
+static void Split (orderLink *link_p, long count, orderLink **first_pp,
+                   orderLink **rest_pp) {
+    if (link_p == NULL) {
+        *first_pp = *rest_pp = NULL;
+    } else if (Size(link_p->left) < count) {
+        Split(link_p->right, count - Size(link_p->left) - 1,
+              &link_p->right, rest_pp);
+        Update(link_p);
+        *first_pp = link_p;
+    } else {
+        Split(link_p->left, count, first_pp, &link_p->left);
+        Update(link_p);
+        *rest_pp = link_p;
+    }
+}
+
+/* Join two trees, every element of first goes before those of rest */
+static orderLink * Merge (orderLink *first_p, orderLink *rest_p) {
+    if (first_p == NULL)
+        return rest_p;
+    if (rest_p == NULL)
+        return first_p;
+    if (first_p->priority > rest_p->priority) {
+        first_p->right = Merge(first_p->right, rest_p);
+        Update(first_p);
+        return first_p;
+    }
+    rest_p->left = Merge(first_p, rest_p->left);
+    Update(rest_p);
+    return rest_p;
+}
+
+static void SetRoot (orderList *order_p, orderLink *root_p) {
+    order_p->root = root_p;
+    if (root_p != NULL)
+        root_p->parent = NULL;
+}
+
+static void FreeLinks (orderLink *link_p, int items) {
+    if (link_p == NULL)
+        return;
+    FreeLinks(link_p->left, items);
+    FreeLinks(link_p->right, items);
+    if (items)
+        FreeItem(link_p->data);
+    free(link_p);
+}
+
+/* Set the sizes and parents of a tree built without them */
+static void Fix (orderLink *link_p) {
+    if (link_p == NULL)
+        return;
+    Fix(link_p->left);
+    Fix(link_p->right);
+    Update(link_p);
+}
+
+/**
+ * @brief Build an order-statistic list with the items of a list.
+ */
+orderList * NewOrderList (GList *myList_p) {
+    orderList  *order_p = malloc(sizeof(orderList));
+    orderLink **spine, *link_p, *last_p;
+    long        top = 0;
+
+    if (order_p == NULL)
+        return NULL;
+    order_p->root = NULL;
+    order_p->seed = 2463534242u;
+    spine = malloc((g_list_length(myList_p) + 1) * sizeof(orderLink *));
+    if (spine == NULL) {
+        free(order_p);
+        return NULL;
+    }
+
+    /*
+     * Cartesian tree in one pass: spine holds the right spine of the tree
+     * built so far, from the root down. A new element goes below the last
+     * node of higher priority and takes the ones it passes as its left
+     * subtree.
+     */
+    for (; myList_p != NULL; myList_p = myList_p->next) {
+        link_p = NewLink(order_p, myList_p->data);
+        if (link_p == NULL) {
+            FreeLinks(top > 0 ? spine[0] : NULL, FALSE);
+            free(spine);
+            free(order_p);
+            return NULL;
+        }
+        for (last_p = NULL; top > 0 &&
+             spine[top - 1]->priority < link_p->priority; )
+            last_p = spine[--top];
+        link_p->left = last_p;
+        if (top > 0)
+            spine[top - 1]->right = link_p;
+        spine[top++] = link_p;
+    }
+
+    if (top > 0) {
+        Fix(spine[0]);
+        SetRoot(order_p, spine[0]);
+    }
+    free(spine);
+    return order_p;
+}
+
+/**
+ * @brief De-allocate an order-statistic list but not its items.
+ */
+void FreeOrderList (orderList *order_p) {
+    if (order_p == NULL)
+        return;
+    FreeLinks(order_p->root, FALSE);
+    free(order_p);
+}
+
+/**
+ * @brief De-allocate an order-statistic list and its items.
+ */
+void DestroyOrderList (orderList *order_p) {
+    if (order_p == NULL)
+        return;
+    FreeLinks(order_p->root, TRUE);
+    free(order_p);
+}
+
+/**
+ * @brief Number of elements.
+ */
+long OrderLength (const orderList *order_p) {
+    return Size(order_p->root);
+}
+
+/**
+ * @brief Element at a position, counting from 0.
+ */
+orderLink * OrderNth (const orderList *order_p, long position) {
+    orderLink *link_p = order_p->root;
+
+    if (position < 0 || position >= Size(link_p))
+        return NULL;
+    while (position != Size(link_p->left)) {
+        if (position < Size(link_p->left)) {
+            link_p = link_p->left;
+        } else {
+            position -= Size(link_p->left) + 1;
+            link_p = link_p->right;
+        }
+    }
+    return link_p;
+}
+
+/**
+ * @brief Position of an element, counting from 0.
+ */
+long OrderRank (const orderLink *link_p) {
+    long rank = Size(link_p->left);
+
+    for (; link_p->parent != NULL; link_p = link_p->parent)
+        if (link_p == link_p->parent->right)
+            rank += Size(link_p->parent->left) + 1;
+    return rank;
+}
+
+/**
+ * @brief Insert an item so that it ends at a position.
+ */
+orderLink * OrderInsertAt (orderList *order_p, long position, node_p item_p) {
+    orderLink *link_p, *first_p, *rest_p;
+
+    if (position < 0 || position > Size(order_p->root))
+        return NULL;
+    link_p = NewLink(order_p, item_p);
+    if (link_p == NULL)
+        return NULL;
+    Split(order_p->root, position, &first_p, &rest_p);
+    SetRoot(order_p, Merge(Merge(first_p, link_p), rest_p));
+    return link_p;
+}
+
+/**
+ * @brief Insert an item in a sorted list, after the items equal to it.
+ */
+orderLink * OrderInsertSorted (orderList *order_p, node_p item_p) {
+    orderLink *link_p = order_p->root;
+    long       position = 0;
+
+    while (link_p != NULL) {
+        if (CompareItems(item_p, link_p->data) < 0) {
+            link_p = link_p->left;
+        } else {
+            position += Size(link_p->left) + 1;
+            link_p = link_p->right;
+        }
+    }
+    return OrderInsertAt(order_p, position, item_p);
+}
+
+/**
+ * @brief Remove an element and de-allocate its item.
+ */
+int OrderRemove (orderList *order_p, orderLink *link_p) {
+    if (link_p == NULL)
+        return EXIT_FAILURE;
+    return OrderRemoveAt(order_p, OrderRank(link_p));
+}
+
+/**
+ * @brief Remove the element at a position and de-allocate its item.
+ */
+int OrderRemoveAt (orderList *order_p, long position) {
+    orderLink *first_p, *middle_p, *rest_p;
+
+    if (position < 0 || position >= Size(order_p->root))
+        return EXIT_FAILURE;
+    Split(order_p->root, position, &first_p, &rest_p);
+    Split(rest_p, 1, &middle_p, &rest_p);
+    SetRoot(order_p, Merge(first_p, rest_p));
+    FreeItem(middle_p->data);
+    free(middle_p);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief First element, or NULL if the list is empty.
+ */
+orderLink * OrderFirst (const orderList *order_p) {
+    orderLink *link_p = order_p->root;
+
+    while (link_p != NULL && link_p->left != NULL)
+        link_p = link_p->left;
+    return link_p;
+}
+
+/**
+ * @brief Element after another one, or NULL after the last one.
+ */
+orderLink * OrderNext (const orderLink *link_p) {
+    orderLink *next_p = link_p->right;
+
+    if (next_p != NULL) {
+        while (next_p->left != NULL)
+            next_p = next_p->left;
+        return next_p;
+    }
+    while (link_p->parent != NULL && link_p == link_p->parent->right)
+        link_p = link_p->parent;
+    return link_p->parent;
+}
+
+/**
+ * @brief Call a visitor for every item, in order.
+ */
+orderLink * OrderForEach (const orderList *order_p, itemVisitor visit,
+                          void *arg_p) {
+    orderLink *link_p;
+
+    for (link_p = OrderFirst(order_p); link_p != NULL;
+         link_p = OrderNext(link_p))
+        if (visit(link_p->data, arg_p) != EXIT_SUCCESS)
+            return link_p;
+    return NULL;
+}
+
+/**
+ * @brief Make a list with the items, in order.
+ */
+GList * OrderToList (const orderList *order_p) {
+    GList     *theList_p = NULL;
+    orderLink *link_p;
+
+    for (link_p = OrderFirst(order_p); link_p != NULL;
+         link_p = OrderNext(link_p))
+        theList_p = g_list_prepend(theList_p, link_p->data);
+    return g_list_reverse(theList_p);
+}
+
+static int PrintVisitor (node_p item_p, void *arg_p) {
+    return PrintItem(item_p);
+}
+
+/**
+ * @brief Print every item with PrintItem().
+ */
+int PrintOrderList (const orderList *order_p) {
+    if (order_p->root == NULL ||
+        OrderForEach(order_p, PrintVisitor, NULL) != NULL)
+        return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,206 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    OrderStat.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 01:40 CST
+ *
+ * @brief   Declares an order-statistic list: a sequence of @c myData
+ *          items kept in a balanced tree where every node knows the size
+ *          of its subtree, so the n-th item, the position of an item and
+ *          inserting or removing at a position take O(log n) time instead
+ *          of the O(n) walks of g_list_nth() and g_list_position().
+ *
+ * References:
+ *          R. Seidel and C. R. Aragon, "Randomized search trees",
+ *          Algorithmica 16(4/5), 1996 (treaps).
+ *          T. H. Cormen et al., "Introduction to Algorithms", 3rd ed.,
+ *          2009, section 14.1 (dynamic order statistics).
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 01:40 CST -- File created
+ *          Mon 19 Oct 2026 07:35 CST -- Corrected the comparison of
+ *                                       OrderInsertSorted() with GLib
+ *
+ * @note    The tree is a treap ordered by position: the balance is kept by
+ *          random priorities, so the times are expected, not worst case.
+ *          The items are shared with the list they come from, not copied.
+ *
+ */
+
+#ifndef ORDERSTAT_H
+#define ORDERSTAT_H
+
+#include <glib.h>
+#include "UserDefined.h"
+#include "Traverse.h"
+
+/**
+ * @struct orderLink
+ *
+ * @brief An element of an order-statistic list. Only @c data may be read,
+ * the other fields belong to the tree.
+ */
+typedef struct orderLink_{
+    node_p              data;     /**< the item                            */
+    struct orderLink_ * left;     /**< items before it in its subtree      */
+    struct orderLink_ * right;    /**< items after it in its subtree       */
+    struct orderLink_ * parent;
+    long                size;     /**< elements in its subtree             */
+    guint32             priority; /**< heap order of the treap             */
+}orderLink;
+
+/**
+ * @typedef orderList
+ *
+ * @brief Opaque order-statistic list.
+ */
+typedef struct orderList_ orderList;
+
+/**
+ *
+ * @brief Build an order-statistic list with the items of a list, in the
+ * same order, in linear time.
+ *
+ * @param  myList_p pointer to the list, it may be NULL. It is not changed
+ *         and its items are shared, not copied.
+ * @return pointer to the new list or NULL if there is no memory.
+ *
+ * @code
+ *  theList_p = g_list_sort(theList_p, (GCompareFunc)CompareItems);
+ *  order_p = NewOrderList(theList_p);
+ *  item_p = OrderNth(order_p, OrderLength(order_p) / 2)->data;   // median
+ * @endcode
+ *
+ */
+orderList * NewOrderList (GList *myList_p);
+
+/**
+ *
+ * @brief De-allocate an order-statistic list but not its items.
+ *
+ */
+void FreeOrderList (orderList *order_p);
+
+/**
+ *
+ * @brief De-allocate an order-statistic list and its items, with
+ * FreeItem().
+ *
+ */
+void DestroyOrderList (orderList *order_p);
+
+/**
+ *
+ * @brief Number of elements.
+ *
+ */
+long OrderLength (const orderList *order_p);
+
+/**
+ *
+ * @brief Element at a position, counting from 0.
+ *
+ * @return pointer to the element, or NULL if @p position is out of range.
+ *
+ */
+orderLink * OrderNth (const orderList *order_p, long position);
+
+/**
+ *
+ * @brief Position of an element, counting from 0.
+ *
+ */
+long OrderRank (const orderLink *link_p);
+
+/**
+ *
+ * @brief Insert an item so that it ends at a position.
+ *
+ * @param  order_p pointer to the list.
+ * @param  position from 0 (the start) to OrderLength() (the end).
+ * @param  item_p the item, it is not copied.
+ * @return pointer to the new element, or NULL if @p position is out of
+ *         range or there is no memory.
+ *
+ */
+orderLink * OrderInsertAt (orderList *order_p, long position, node_p item_p);
+
+/**
+ *
+ * @brief Insert an item in a list sorted with CompareItems(), after the
+ * items equal to it, so equal items stay in the order they were inserted.
+ * Note that g_list_insert_sorted() puts it before them instead.
+ *
+ * @return pointer to the new element, or NULL if there is no memory.
+ *
+ */
+orderLink * OrderInsertSorted (orderList *order_p, node_p item_p);
+
+/**
+ *
+ * @brief Remove an element and de-allocate its item with FreeItem().
+ *
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if @p link_p is NULL.
+ *
+ */
+int OrderRemove (orderList *order_p, orderLink *link_p);
+
+/**
+ *
+ * @brief Remove the element at a position and de-allocate its item.
+ *
+ * @return @c EXIT_SUCCESS, or @c EXIT_FAILURE if @p position is out of
+ *         range.
+ *
+ */
+int OrderRemoveAt (orderList *order_p, long position);
+
+/**
+ *
+ * @brief First element, or NULL if the list is empty.
+ *
+ */
+orderLink * OrderFirst (const orderList *order_p);
+
+/**
+ *
+ * @brief Element after another one, or NULL after the last one.
+ *
+ * Walking the whole list with OrderFirst() and OrderNext() takes linear
+ * time.
+ *
+ */
+orderLink * OrderNext (const orderLink *link_p);
+
+/**
+ *
+ * @brief Call a visitor for every item, in order, as ListForEach().
+ *
+ * @return pointer to the element where @p visit stopped, or NULL if every
+ *         item was visited.
+ *
+ */
+orderLink * OrderForEach (const orderList *order_p, itemVisitor visit,
+                          void *arg_p);
+
+/**
+ *
+ * @brief Make a list with the items, in order. The items are shared.
+ *
+ */
+GList * OrderToList (const orderList *order_p);
+
+/**
+ *
+ * @brief Print every item with PrintItem(), as PrintList().
+ *
+ * @return @c EXIT_SUCCESS if the list was printed, @c EXIT_FAILURE if it
+ *         is empty or an item could not be printed.
+ *
+ */
+int PrintOrderList (const orderList *order_p);
+
+#endif
@@ -0,0 +1,461 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    PrefixIndex.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 00:05 CST
+ *
+ * @brief   Implements a list with an attached radix tree over the
+ *          @c theString field of its items.
+ *
+ * References:
+ *          D. E. Knuth, "The Art of Computer Programming", vol. 3,
+ *          section 6.3 (digital searching).
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 00:05 CST -- File created
+ *
+ * @note    Each node is one allocation with its label at the end. Its
+ *          children are kept in an array sorted by the first byte of their
+ *          labels, and the elements whose string ends at the node are kept
+ *          in the node itself when there is only one of them. Removing
+ *          elements deletes the nodes left empty and merges a node with
+ *          its only child, so every node without elements of its own has
+ *          at least two children and a search visits at most two nodes
+ *          per element found.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <string.h>                       /* Used for memcpy & strlen */
+#include <glib.h>                        /* Used for the list functions */
+#include "PrefixIndex.h"                              /* Function header */
+
+typedef struct trieNode_{
+    struct trieNode_ ** children;          /* Sorted by their first byte */
+    union {
+        GList  *  one;                     /* When numLinks is 1         */
+        GList  ** many;                    /* Capacity is a power of two */
+    }links;
+    unsigned int        numLinks;          /* Strings that end here      */
+    unsigned int        count;             /* Links in the whole subtree */
+    unsigned int        length;            /* Bytes in the label         */
+    unsigned short      numChildren;
+    char                label[];
+}trieNode;
+
+static trieNode * NewNode (prefixList *prefix_p, const char *label,
+                           size_t length) {
+    trieNode *node_p = malloc(sizeof(trieNode) + length);
+
+    if (node_p == NULL)
+        return NULL;
+    node_p->children = NULL;
+    node_p->links.many = NULL;
+    node_p->numLinks = node_p->count = 0;
+    node_p->numChildren = 0;
+    node_p->length = length;
+    memcpy(node_p->label, label, length);
+    prefix_p->nodes++;
+    return node_p;
+}
+
+static void FreeNode (prefixList *prefix_p, trieNode *node_p) {
+    if (node_p->numLinks > 1)
+        free(node_p->links.many);
+    free(node_p->children);
+    free(node_p);
+    prefix_p->nodes--;
+}
+
+static void FreeTree (prefixList *prefix_p, trieNode *node_p) {
+    int i;
+
+    for (i = 0; i < node_p->numChildren; i++)
+        FreeTree(prefix_p, node_p->children[i]);
+    FreeNode(prefix_p, node_p);
+}
+
+/* Index of the child whose label starts with c, or where it would go */
+static int FindChild (const trieNode *node_p, unsigned char c, int *found_p) {
+    int low = 0, high = node_p->numChildren, middle;
+
+    while (low < high) {
+        middle = (low + high) / 2;
+        if ((unsigned char)node_p->children[middle]->label[0] < c)
+            low = middle + 1;
+        else
+            high = middle;
+    }
+    *found_p = low < node_p->numChildren &&
+               (unsigned char)node_p->children[low]->label[0] == c;
+    return low;
+}
+
+/* Bytes at the start of a label that match a string */
+static size_t Common (const trieNode *node_p, const char *string) {
+    size_t i;
+
+    for (i = 0; i < node_p->length && node_p->label[i] == string[i]; i++)
+        ;
+    return i;
+}
+
+static int AddChild (trieNode *node_p, int i, trieNode *child_p) {
+    trieNode **children = realloc(node_p->children,
+                                  (node_p->numChildren + 1)
+                                  * sizeof(trieNode *));
+
+    if (children == NULL)
+        return EXIT_FAILURE;
+    memmove(children + i + 1, children + i,
+            (node_p->numChildren - i) * sizeof(trieNode *));
+    children[i] = child_p;
+    node_p->children = children;
+    node_p->numChildren++;
+    return EXIT_SUCCESS;
+}
+
+static void DropChild (trieNode *node_p, int i) {
+    node_p->numChildren--;
+    memmove(node_p->children + i, node_p->children + i + 1,
+            (node_p->numChildren - i) * sizeof(trieNode *));
+    if (node_p->numChildren == 0) {
+        free(node_p->children);
+        node_p->children = NULL;
+    }
+}
+
+static int AddLink (trieNode *node_p, GList *link_p) {
+    unsigned int n = node_p->numLinks;
+    GList      **many;
+
+    if (n == 0) {
+        node_p->links.one = link_p;
+    } else if (n == 1) {
+        many = malloc(2 * sizeof(GList *));
+        if (many == NULL)
+            return EXIT_FAILURE;
+        many[0] = node_p->links.one;
+        many[1] = link_p;
+        node_p->links.many = many;
+    } else {
+        if ((n & (n - 1)) == 0) {                           /* Array full */
+            many = realloc(node_p->links.many, 2 * n * sizeof(GList *));
+            if (many == NULL)
+                return EXIT_FAILURE;
+            node_p->links.many = many;
+        }
+        node_p->links.many[n] = link_p;
+    }
+    node_p->numLinks++;
+    return EXIT_SUCCESS;
+}
+
+static int DropLink (trieNode *node_p, GList *link_p) {
+    GList      **many = node_p->links.many;
+    unsigned int i;
+
+    if (node_p->numLinks == 1) {
+        if (node_p->links.one != link_p)
+            return EXIT_FAILURE;
+        node_p->links.one = NULL;
+    } else {
+        for (i = 0; i < node_p->numLinks && many[i] != link_p; i++)
+            ;
+        if (i == node_p->numLinks)
+            return EXIT_FAILURE;
+        many[i] = many[node_p->numLinks - 1];
+        if (node_p->numLinks == 2) {
+            node_p->links.one = many[0];
+            free(many);
+        }
+    }
+    node_p->numLinks--;
+    return EXIT_SUCCESS;
+}
+
+/* Add a link below node_p, rest is the part of its string still to match */
+static int Insert (prefixList *prefix_p, trieNode *node_p, const char *rest,
+                   GList *link_p) {
+    trieNode *child_p, *middle_p;
+    size_t    common;
+    int       i, found;
+
+    if (*rest == '\0') {
+        if (AddLink(node_p, link_p) != EXIT_SUCCESS)
+            return EXIT_FAILURE;
+    } else {
+        i = FindChild(node_p, *rest, &found);
+        if (!found) {
+            child_p = NewNode(prefix_p, rest, strlen(rest));
+            if (child_p == NULL)
+                return EXIT_FAILURE;
+            if (AddChild(node_p, i, child_p) != EXIT_SUCCESS) {
+                FreeNode(prefix_p, child_p);
+                return EXIT_FAILURE;
+            }
+            child_p->links.one = link_p;
+            child_p->numLinks = child_p->count = 1;
+        } else {
+            child_p = node_p->children[i];
+            common = Common(child_p, rest);
+            if (common < child_p->length) {
+                /* Split the label, the child keeps the end of it */
+                middle_p = NewNode(prefix_p, child_p->label, common);
+                if (middle_p == NULL ||
+                    AddChild(middle_p, 0, child_p) != EXIT_SUCCESS) {
+                    if (middle_p != NULL)
+                        FreeNode(prefix_p, middle_p);
+                    return EXIT_FAILURE;
+                }
+                child_p->length -= common;
+                memmove(child_p->label, child_p->label + common,
+                        child_p->length);
+                middle_p->count = child_p->count;
+                node_p->children[i] = child_p = middle_p;
+            }
+            if (Insert(prefix_p, child_p, rest + common, link_p)
+                != EXIT_SUCCESS)
+                return EXIT_FAILURE;
+        }
+    }
+    node_p->count++;
+    return EXIT_SUCCESS;
+}
+
+/* Join a node without links of its own with its only child */
+static void Merge (prefixList *prefix_p, trieNode *node_p, int i) {
+    trieNode *child_p = node_p->children[i];
+    trieNode *only_p = child_p->children[0];
+    trieNode *merged_p = realloc(only_p, sizeof(trieNode) + child_p->length
+                                         + only_p->length);
+
+    if (merged_p == NULL)
+        return;                           /* The tree is still correct */
+    memmove(merged_p->label + child_p->length, merged_p->label,
+            merged_p->length);
+    memcpy(merged_p->label, child_p->label, child_p->length);
+    merged_p->length += child_p->length;
+    node_p->children[i] = merged_p;
+    child_p->numChildren = 0;
+    FreeNode(prefix_p, child_p);
+}
+
+/* Take a link out of the tree below node_p, deleting the nodes left empty */
+static int Remove (prefixList *prefix_p, trieNode *node_p, const char *rest,
+                   GList *link_p) {
+    trieNode *child_p;
+    int       i, found;
+
+    if (*rest == '\0') {
+        if (node_p->numLinks == 0 || DropLink(node_p, link_p) != EXIT_SUCCESS)
+            return EXIT_FAILURE;
+    } else {
+        i = FindChild(node_p, *rest, &found);
+        if (!found)
+            return EXIT_FAILURE;
+        child_p = node_p->children[i];
+        if (Common(child_p, rest) < child_p->length ||
+            Remove(prefix_p, child_p, rest + child_p->length, link_p)
+            != EXIT_SUCCESS)
+            return EXIT_FAILURE;
+        if (child_p->count == 0) {
+            DropChild(node_p, i);
+            FreeNode(prefix_p, child_p);
+        } else if (child_p->numLinks == 0 && child_p->numChildren == 1) {
+            Merge(prefix_p, node_p, i);
+        }
+    }
+    node_p->count--;
+    return EXIT_SUCCESS;
+}
+
+/* Node whose subtree holds the strings that start with prefix, or NULL.
+ * exact_p tells whether prefix ends at the node and not inside its label */
+static const trieNode * Descend (const trieNode *node_p, const char *prefix,
+                                 int *exact_p) {
+    size_t common;
+    int    i, found;
+
+    *exact_p = TRUE;
+    while (*prefix != '\0') {
+        i = FindChild(node_p, *prefix, &found);
+        if (!found)
+            return NULL;
+        node_p = node_p->children[i];
+        common = Common(node_p, prefix);
+        if (prefix[common] == '\0') {
+            *exact_p = common == node_p->length;
+            return node_p;
+        }
+        if (common < node_p->length)
+            return NULL;
+        prefix += common;
+    }
+    return node_p;
+}
+
+/* Visit the links of a subtree in order, returns FALSE if visit stopped */
+static int Visit (const trieNode *node_p, linkVisitor visit, void *arg_p,
+                  long *visited_p) {
+    unsigned int i;
+
+    for (i = 0; i < node_p->numLinks; i++) {
+        ++*visited_p;
+        if (visit(node_p->numLinks == 1 ? node_p->links.one
+                                        : node_p->links.many[i], arg_p)
+            != EXIT_SUCCESS)
+            return FALSE;
+    }
+    for (i = 0; i < node_p->numChildren; i++)
+        if (!Visit(node_p->children[i], visit, arg_p, visited_p))
+            return FALSE;
+    return TRUE;
+}
+
+static size_t Bytes (const trieNode *node_p) {
+    size_t       bytes = sizeof(trieNode) + node_p->length
+                         + node_p->numChildren * sizeof(trieNode *);
+    unsigned int i;
+
+    unsigned int capacity = 2;
+
+    if (node_p->numLinks > 1) {
+        while (capacity < node_p->numLinks)
+            capacity *= 2;
+        bytes += capacity * sizeof(GList *);
+    }
+    for (i = 0; i < node_p->numChildren; i++)
+        bytes += Bytes(node_p->children[i]);
+    return bytes;
+}
+
+/**
+ * @brief Attach a radix tree to a list.
+ */
+prefixList * NewPrefixList (GList * myList_p) {
+    prefixList *prefix_p = calloc(1, sizeof(prefixList));
+    GList      *l;
+
+    if (prefix_p == NULL)
+        return NULL;
+    prefix_p->root = NewNode(prefix_p, "", 0);
+    if (prefix_p->root == NULL) {
+        free(prefix_p);
+        return NULL;
+    }
+    prefix_p->list = myList_p;
+    for (l = myList_p; l != NULL; l = l->next)
+        if (Insert(prefix_p, prefix_p->root,
+                   ((node_p)l->data)->theString, l) != EXIT_SUCCESS) {
+            FreePrefixList(prefix_p);
+            return NULL;
+        }
+    return prefix_p;
+}
+
+/**
+ * @brief De-allocate the tree and return the list.
+ */
+GList * FreePrefixList (prefixList *prefix_p) {
+    GList *theList_p;
+
+    if (prefix_p == NULL)
+        return NULL;
+    theList_p = prefix_p->list;
+    FreeTree(prefix_p, prefix_p->root);
+    free(prefix_p);
+    return theList_p;
+}
+
+/**
+ * @brief Insert an item at the end of the list.
+ */
+int PrefixAppend (prefixList *prefix_p, node_p item_p) {
+    return PrefixInsertBefore(prefix_p, NULL, item_p);
+}
+
+/**
+ * @brief Insert an item at the start of the list.
+ */
+int PrefixPrepend (prefixList *prefix_p, node_p item_p) {
+    return PrefixInsertBefore(prefix_p, prefix_p->list, item_p);
+}
+
+/**
+ * @brief Insert an item before an element of the list.
+ */
+int PrefixInsertBefore (prefixList *prefix_p, GList *sibling_p,
+                        node_p item_p) {
+    GList *link_p;
+
+    if (item_p == NULL || item_p->theString == NULL)
+        return EXIT_FAILURE;
+    prefix_p->list = g_list_insert_before(prefix_p->list, sibling_p, item_p);
+    link_p = sibling_p != NULL ? sibling_p->prev : g_list_last(prefix_p->list);
+    if (Insert(prefix_p, prefix_p->root, item_p->theString, link_p)
+        != EXIT_SUCCESS) {
+        prefix_p->list = g_list_delete_link(prefix_p->list, link_p);
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Remove an element, which also frees its data.
+ */
+int PrefixRemove (prefixList *prefix_p, GList *link_p) {
+    if (link_p == NULL ||
+        Remove(prefix_p, prefix_p->root, ((node_p)link_p->data)->theString,
+               link_p) != EXIT_SUCCESS)
+        return EXIT_FAILURE;
+    prefix_p->list = RemoveFromList(prefix_p->list, link_p);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Find an element whose string is equal to another one.
+ */
+GList * PrefixFind (const prefixList *prefix_p, const char *theString) {
+    int             exact;
+    const trieNode *node_p = Descend(prefix_p->root, theString, &exact);
+
+    if (node_p == NULL || !exact || node_p->numLinks == 0)
+        return NULL;
+    return node_p->numLinks == 1 ? node_p->links.one : node_p->links.many[0];
+}
+
+/**
+ * @brief Number of elements whose string starts with a prefix.
+ */
+long PrefixCount (const prefixList *prefix_p, const char *prefix) {
+    int             exact;
+    const trieNode *node_p = Descend(prefix_p->root, prefix, &exact);
+
+    return node_p != NULL ? node_p->count : 0;
+}
+
+/**
+ * @brief Call a visitor for every element whose string starts with a
+ * prefix.
+ */
+long PrefixMatches (const prefixList *prefix_p, const char *prefix,
+                    linkVisitor visit, void *arg_p) {
+    int             exact;
+    const trieNode *node_p = Descend(prefix_p->root, prefix, &exact);
+    long            visited = 0;
+
+    if (node_p != NULL)
+        Visit(node_p, visit, arg_p, &visited);
+    return visited;
+}
+
+/**
+ * @brief Bytes of memory used by the tree.
+ */
+size_t PrefixBytes (const prefixList *prefix_p) {
+    return sizeof(prefixList) + Bytes(prefix_p->root);
+}
@@ -0,0 +1,168 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    PrefixIndex.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 00:05 CST
+ *
+ * @brief   Declares a list with an attached radix tree over the
+ *          @c theString field of its items, so all the elements whose
+ *          string starts with a prefix are found without scanning the
+ *          list.
+ *
+ * References:
+ *          D. R. Morrison, "PATRICIA -- Practical Algorithm To Retrieve
+ *          Information Coded in Alphanumeric", JACM 15(4), 1968.
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 00:05 CST -- File created
+ *
+ * @warning The tree only learns about items inserted with the functions
+ *          in this file, and it finds elements by their string, so the
+ *          string of an item must not change while it is in the list.
+ *
+ * @note    The tree holds the elements (links) of the list, not copies of
+ *          the items. Strings are compared byte by byte, as strcmp() does.
+ *
+ */
+
+#ifndef PREFIXINDEX_H
+#define PREFIXINDEX_H
+
+#include <stddef.h>
+#include <glib.h>
+#include "UserDefined.h"
+
+/**
+ * @typedef linkVisitor
+ *
+ * @brief Function called once per element found. Return @c EXIT_SUCCESS
+ * to keep going, any other value stops the search.
+ */
+typedef int (*linkVisitor)(GList *link_p, void *arg_p);
+
+/**
+ * @struct prefixList
+ *
+ * @brief A list together with the radix tree of its strings.
+ */
+typedef struct prefixList_{
+    GList            * list;    /**< the list, may be read directly       */
+    struct trieNode_ * root;    /**< the tree, the root has no label      */
+    long               nodes;   /**< nodes in the tree                    */
+}prefixList;
+
+/**
+ *
+ * @brief Attach a radix tree to a list.
+ *
+ * @param  myList_p pointer to the list, it may be NULL.
+ * @return pointer to the new structure or NULL if there is no memory.
+ *
+ * @code
+ *  prefix_p = NewPrefixList(theList_p);
+ *  count = PrefixCount(prefix_p, "Do");
+ * @endcode
+ *
+ */
+prefixList * NewPrefixList (GList * myList_p);
+
+/**
+ *
+ * @brief De-allocate the tree and return the list, which is not modified.
+ *
+ */
+GList * FreePrefixList (prefixList *prefix_p);
+
+/**
+ *
+ * @brief Insert an item at the end of the list.
+ *
+ * @return @c EXIT_SUCCESS if the item was inserted, otherwise
+ *         @c EXIT_FAILURE.
+ *
+ */
+int PrefixAppend (prefixList *prefix_p, node_p item_p);
+
+/**
+ *
+ * @brief Insert an item at the start of the list.
+ *
+ * @return @c EXIT_SUCCESS if the item was inserted, otherwise
+ *         @c EXIT_FAILURE.
+ *
+ */
+int PrefixPrepend (prefixList *prefix_p, node_p item_p);
+
+/**
+ *
+ * @brief Insert an item before an element of the list, or at its end if
+ * @p sibling_p is NULL.
+ *
+ * @return @c EXIT_SUCCESS if the item was inserted, otherwise
+ *         @c EXIT_FAILURE (the list is then not changed).
+ *
+ */
+int PrefixInsertBefore (prefixList *prefix_p, GList *sibling_p,
+                        node_p item_p);
+
+/**
+ *
+ * @brief Remove an element with RemoveFromList(), which also frees its
+ * data.
+ *
+ * @return @c EXIT_SUCCESS if the element was removed, @c EXIT_FAILURE if
+ *         it is NULL or not in the tree.
+ *
+ */
+int PrefixRemove (prefixList *prefix_p, GList *link_p);
+
+/**
+ *
+ * @brief Find an element whose string is equal to another one.
+ *
+ * @return pointer to the element, or NULL if there is none. If several
+ *         match, which one is returned is not specified.
+ *
+ */
+GList * PrefixFind (const prefixList *prefix_p, const char *theString);
+
+/**
+ *
+ * @brief Number of elements whose string starts with a prefix, in time
+ * proportional to the length of the prefix.
+ *
+ */
+long PrefixCount (const prefixList *prefix_p, const char *prefix);
+
+/**
+ *
+ * @brief Call a visitor for every element whose string starts with a
+ * prefix.
+ *
+ * @b PrefixMatches() visits the elements in the order of their strings,
+ * and the time it takes is proportional to the length of the prefix plus
+ * the number of elements visited, so it also serves autocompletion: stop
+ * after the first few.
+ *
+ * @param  prefix_p pointer to the list with its tree.
+ * @param  prefix the prefix, "" matches every element.
+ * @param  visit function called for each element, it must not change the
+ *         list.
+ * @param  arg_p passed to @p visit.
+ * @return number of elements visited.
+ *
+ */
+long PrefixMatches (const prefixList *prefix_p, const char *prefix,
+                    linkVisitor visit, void *arg_p);
+
+/**
+ *
+ * @brief Bytes of memory used by the tree, not counting the list.
+ *
+ */
+size_t PrefixBytes (const prefixList *prefix_p);
+
+#endif
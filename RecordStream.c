@@ -0,0 +1,375 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    RecordStream.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 11:05 CST
+ *
+ * @brief   Implements the streaming parser for node files.
+ *
+ * References:
+ *          Follows the same parsing rules as GetInt() and GetString() in
+ *          FileIO.c.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 11:05 CST -- File created
+ *          Sun 18 Oct 2026 19:05 CST -- Tokens are found with the
+ *                                       boundaries from IndexTokens() and
+ *                                       numbers are converted eight digits
+ *                                       at a time
+ *
+ * @note    The input is read in blocks into a single buffer that is
+ *          reused for every record. Strings are terminated in place, so
+ *          no memory is allocated per record. The buffer only grows if a
+ *          single string does not fit in it.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <stdio.h>                       /* Used to handle the FILE type */
+#include <string.h>                      /* Used for memmove & strcmp */
+#include "RecordStream.h"                             /* Function header */
+#include "UserDefined.h"              /* Used for the order & key enums */
+#include "Stats.h"                  /* Optional instrumentation counters */
+#include "TokenScan.h"                  /* Used to find the token bounds */
+
+/** @def  STREAM_BUFSIZE
+ * @brief Initial size of the block buffer of a stream.
+ */
+#define STREAM_BUFSIZE 65536
+
+/** @def  STREAM_PADDING
+ * @brief Bytes allocated after the buffer, for the string terminator and
+ * for ParseDigits(), which reads eight bytes at a time.
+ */
+#define STREAM_PADDING 8
+
+struct recordStream_{
+    recordFill fill;                       /* Gets more input            */
+    void     * source_p;                   /* Argument for fill          */
+    char     * buffer;                     /* Block buffer (+ padding)   */
+    size_t     size;                       /* Usable size of the buffer  */
+    size_t     head;                       /* Next byte to parse         */
+    size_t     tail;                       /* End of the valid bytes     */
+    int        eof;                        /* fill returned 0            */
+    tokenIndex*index;                      /* Token boundaries in buffer */
+};
+
+static size_t FileFill (void *source_p, char *buffer_p, size_t size) {
+    return fread(buffer_p, 1, size, (FILE *)source_p);
+}
+
+/*
+ * Get more input keeping the bytes from *mark_p onwards (the string being
+ * parsed), or none if mark_p is NULL. Kept bytes are moved to the start of
+ * the buffer so *mark_p becomes 0.
+ */
+static int Refill (recordStream *stream_p, size_t *mark_p) {
+    size_t keep = mark_p ? *mark_p : stream_p->tail;
+    size_t n;
+    char * bigger;
+
+    if (stream_p->eof)
+        return EOF;
+
+    memmove(stream_p->buffer, stream_p->buffer + keep,
+            stream_p->tail - keep);
+    stream_p->tail -= keep;
+    stream_p->head -= keep;
+    if (mark_p)
+        *mark_p = 0;
+
+    if (stream_p->tail == stream_p->size) {   /* A very long string */
+        bigger = realloc(stream_p->buffer,
+                         2 * stream_p->size + STREAM_PADDING);
+        if (bigger != NULL) {
+            stream_p->buffer = bigger;
+            stream_p->size *= 2;
+        }
+    }
+
+    n = 0;
+    if (stream_p->tail < stream_p->size)
+        n = stream_p->fill(stream_p->source_p,
+                           stream_p->buffer + stream_p->tail,
+                           stream_p->size - stream_p->tail);
+    STATS_ADD(STATS_BYTES_PARSED, n);
+    stream_p->tail += n;
+
+    /* The index always describes the bytes in [0, tail) */
+    if (IndexTokens(stream_p->index, stream_p->buffer, stream_p->tail)
+        != EXIT_SUCCESS) {
+        stream_p->head = stream_p->tail = 0;     /* No memory ends input */
+        IndexTokens(stream_p->index, stream_p->buffer, 0);
+        n = 0;
+    }
+    if (n == 0) {
+        stream_p->eof = 1;
+        return EOF;
+    }
+    return EXIT_SUCCESS;
+}
+
+/* Skip the rest of a comment line, the newline included */
+static int SkipComment (recordStream *stream_p) {
+    const char *newline;
+
+    for (;;) {
+        newline = memchr(stream_p->buffer + stream_p->head, '\n',
+                         stream_p->tail - stream_p->head);
+        if (newline != NULL) {
+            stream_p->head = newline - stream_p->buffer + 1;
+            return '\n';
+        }
+        stream_p->head = stream_p->tail;
+        if (Refill(stream_p, NULL) == EOF)
+            return EOF;
+    }
+}
+
+/* ASCII tests, the same as isdigit() and isalpha() in the "C" locale */
+static inline int IsDigit (int c) {
+    return c >= '0' && c <= '9';
+}
+
+static inline int IsLetter (int c) {
+    return (c | 0x20) >= 'a' && (c | 0x20) <= 'z';
+}
+
+static inline int IsNumberStart (int c) {
+    return IsDigit(c) || c == '-' || c == '#';
+}
+
+static inline int IsStringStart (int c) {
+    return IsLetter(c) || c == '#';
+}
+
+/*
+ * Consume the first byte at or after head that may start a token. Such a
+ * byte is either at head or at a token boundary, so the bytes in between
+ * are never looked at.
+ */
+static inline int SkipTo (recordStream *stream_p, int (*starts)(int)) {
+    size_t at = stream_p->head;
+    int    c;
+
+    for (;;) {
+        while (at < stream_p->tail) {
+            c = (unsigned char)stream_p->buffer[at];
+            if (starts(c)) {
+                stream_p->head = at + 1;
+                return c;
+            }
+            at = NextBoundary(stream_p->index, at + 1);
+        }
+        stream_p->head = stream_p->tail;
+        if (Refill(stream_p, NULL) == EOF)
+            return EOF;
+        at = stream_p->head;
+    }
+}
+
+/* First byte at or after from that is not in a run of digits or letters */
+static inline size_t EndOfRun (recordStream *stream_p, size_t from,
+                               int (*inRun)(int)) {
+    while (from < stream_p->tail &&
+           inRun((unsigned char)stream_p->buffer[from]))
+        from = NextBoundary(stream_p->index, from + 1);
+    return from;
+}
+
+/**
+ * @brief Create a streaming parser that reads from an open file.
+ */
+recordStream * OpenRecordStream (FILE *fp) {
+    if (fp == NULL)
+        return NULL;
+    return OpenRecordSource(FileFill, fp);
+}
+
+/**
+ * @brief Create a streaming parser that reads from a user-supplied source.
+ */
+recordStream * OpenRecordSource (recordFill fill, void *source_p) {
+    recordStream *stream_p = malloc(sizeof(struct recordStream_));
+
+    if (stream_p == NULL)
+        return NULL;
+    stream_p->buffer = malloc(STREAM_BUFSIZE + STREAM_PADDING);
+    stream_p->index = NewTokenIndex();
+    if (stream_p->buffer == NULL || stream_p->index == NULL) {
+        free(stream_p->buffer);
+        FreeTokenIndex(stream_p->index);
+        free(stream_p);
+        return NULL;
+    }
+    stream_p->fill = fill;
+    stream_p->source_p = source_p;
+    stream_p->size = STREAM_BUFSIZE;
+    stream_p->head = stream_p->tail = 0;
+    stream_p->eof = 0;
+    return stream_p;
+}
+
+/**
+ * @brief De-allocate the memory used by a stream.
+ */
+void CloseRecordStream (recordStream *stream_p) {
+    if (stream_p != NULL) {
+        free(stream_p->buffer);
+        FreeTokenIndex(stream_p->index);
+        free(stream_p);
+    }
+}
+
+/**
+ * @brief Parse the next record of the stream.
+ */
+int NextRecord (recordStream *stream_p, recordView *record_p) {
+    int          c, sign = 1;
+    unsigned int i;
+    size_t       mark, end;
+
+    /* Number: same rules as GetInt() */
+    do {
+        c = SkipTo(stream_p, IsNumberStart);
+        if (c == '#')
+            c = SkipComment(stream_p);
+        if (c == '-')
+            sign = -1;
+    } while (!IsDigit(c) && c != EOF);
+
+    if (c == EOF)
+        return EOF;
+
+    i = c - '0';
+    for (;;) {
+        end = EndOfRun(stream_p, stream_p->head, IsDigit);
+        i = ParseDigits(i, stream_p->buffer + stream_p->head,
+                        end - stream_p->head);
+        stream_p->head = end;
+        if (stream_p->head < stream_p->tail) {
+            stream_p->head++;               /* The delimiter is consumed */
+            break;
+        }
+        if (Refill(stream_p, NULL) == EOF)
+            break;
+    }
+    record_p->number = (int)(sign < 0 ? 0u - i : i);
+
+    /* String: same rules as GetString() */
+    do {
+        c = SkipTo(stream_p, IsStringStart);
+        if (c == '#')
+            c = SkipComment(stream_p);
+    } while (!IsLetter(c) && c != EOF);
+
+    if (c == EOF) {
+        stream_p->buffer[stream_p->head] = '\0';
+        record_p->theString = stream_p->buffer + stream_p->head;
+        record_p->length = 0;
+        STATS_INC(STATS_TOKENS_PARSED);
+        return EXIT_SUCCESS;
+    }
+
+    mark = stream_p->head - 1;
+    for (;;) {
+        stream_p->head = EndOfRun(stream_p, stream_p->head, IsLetter);
+        if (stream_p->head < stream_p->tail) {
+            c = (unsigned char)stream_p->buffer[stream_p->head++];
+            break;
+        }
+        if (Refill(stream_p, &mark) == EOF) {
+            c = EOF;
+            break;
+        }
+    }
+
+    /* Terminate in place, over the consumed delimiter if there is one */
+    record_p->length = stream_p->head - mark - (c != EOF);
+    record_p->theString = stream_p->buffer + mark;
+    stream_p->buffer[mark + record_p->length] = '\0';
+
+    STATS_ADD(STATS_TOKENS_PARSED, 2);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Compare a record against a user-supplied value.
+ */
+int MatchRecord (const recordView *record_p, const void *value_p, int key) {
+    switch (key) {
+        case INT:
+            return record_p->number == ((node_p)value_p)->number ?
+                   EQUAL : NOTEQUAL;
+        case STR:
+            return strcmp(record_p->theString,
+                          ((node_p)value_p)->theString) == 0 ?
+                   EQUAL : NOTEQUAL;
+        case SINGLEINT:
+            return record_p->number == *((const int *)value_p) ?
+                   EQUAL : NOTEQUAL;
+        case SINGLESTR:
+            return strcmp(record_p->theString, (const char *)value_p) == 0 ?
+                   EQUAL : NOTEQUAL;
+        default:
+            return NOTEQUAL;
+    }
+}
+
+/**
+ * @brief Call a visitor for every remaining record of the stream.
+ */
+long StreamRecords (recordStream *stream_p, recordVisitor visit,
+                    void *arg_p) {
+    recordView record;
+    long       count = 0;
+
+    while (NextRecord(stream_p, &record) != EOF) {
+        count++;
+        if (visit(&record, arg_p) != EXIT_SUCCESS)
+            break;
+    }
+    return count;
+}
+
+/**
+ * @brief Advance the stream up to the next record that matches a value.
+ */
+int StreamFind (recordStream *stream_p, const void *value_p, int key,
+                recordView *record_p) {
+    while (NextRecord(stream_p, record_p) != EOF)
+        if (MatchRecord(record_p, value_p, key) == EQUAL)
+            return EXIT_SUCCESS;
+    return EXIT_FAILURE;
+}
+
+/**
+ * @brief Call a visitor for every remaining record that matches a value.
+ */
+long StreamFilter (recordStream *stream_p, const void *value_p, int key,
+                   recordVisitor visit, void *arg_p) {
+    recordView record;
+    long       count = 0;
+
+    while (StreamFind(stream_p, value_p, key, &record) == EXIT_SUCCESS) {
+        count++;
+        if (visit(&record, arg_p) != EXIT_SUCCESS)
+            break;
+    }
+    return count;
+}
+
+/**
+ * @brief Count the remaining records that match a value.
+ */
+long StreamCount (recordStream *stream_p, const void *value_p, int key) {
+    recordView record;
+    long       count = 0;
+
+    while (StreamFind(stream_p, value_p, key, &record) == EXIT_SUCCESS)
+        count++;
+    return count;
+}
@@ -0,0 +1,188 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    RecordStream.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 11:05 CST
+ *
+ * @brief   Streaming parser for node files. Records are produced one at a
+ *          time without building a list or allocating memory per record.
+ *
+ * References:
+ *          Follows the same parsing rules as GetInt() and GetString() in
+ *          FileIO.c.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 11:05 CST -- File created
+ *
+ * @note    A record is a number followed by a string, exactly what a call
+ *          to GetInt() followed by a call to GetString() would return.
+ *          Comments start with a # and end at the end of the line.
+ *
+ */
+
+#ifndef RECORDSTREAM_H
+#define RECORDSTREAM_H
+
+#include <stdio.h>
+#include <stddef.h>
+
+/**
+ * @struct recordView
+ *
+ * @brief One record of a node file as seen by the streaming parser.
+ *
+ * @c theString points inside the stream buffer, it is NULL terminated and
+ * it is only valid until the next call that reads from the same stream.
+ * Use NewItem() to keep a copy.
+ */
+typedef struct recordView_{
+    int          number;                  /**< number field of the record */
+    const char * theString;               /**< view of the string field   */
+    size_t       length;                  /**< length of @c theString     */
+}recordView;
+
+/**
+ * @typedef recordStream
+ *
+ * @brief Opaque state of the streaming parser.
+ */
+typedef struct recordStream_ recordStream;
+
+/**
+ * @typedef recordFill
+ *
+ * @brief Function that copies up to @p size bytes of input into
+ * @p buffer_p and returns how many were copied, 0 at the end of input.
+ */
+typedef size_t (*recordFill)(void *source_p, char *buffer_p, size_t size);
+
+/**
+ * @typedef recordVisitor
+ *
+ * @brief Function called once per record. Return @c EXIT_SUCCESS to keep
+ * going, any other value stops the traversal.
+ */
+typedef int (*recordVisitor)(const recordView *record_p, void *arg_p);
+
+/**
+ *
+ * @brief Create a streaming parser that reads from an open file.
+ *
+ * @b OpenRecordStream reads @p fp in large blocks, so the file position
+ * of @p fp is not meaningful while the stream is open.
+ *
+ * @param  fp is a pointer to the input text file to parse.
+ * @return pointer to the new stream or NULL if there is no memory.
+ *
+ * @code
+ *  stream_p = OpenRecordStream(fp);
+ *  while (NextRecord(stream_p, &record) != EOF)
+ *     printf("%d %s\n", record.number, record.theString);
+ *  CloseRecordStream(stream_p);
+ * @endcode
+ *
+ */
+recordStream * OpenRecordStream (FILE *fp);
+
+/**
+ *
+ * @brief Create a streaming parser that reads from a user-supplied source.
+ *
+ * @param  fill is the function called every time the parser needs input.
+ * @param  source_p is passed unchanged to @p fill.
+ * @return pointer to the new stream or NULL if there is no memory.
+ *
+ */
+recordStream * OpenRecordSource (recordFill fill, void *source_p);
+
+/**
+ *
+ * @brief De-allocate the memory used by a stream. The file is not closed.
+ *
+ * @param  stream_p is a pointer to the stream.
+ *
+ */
+void CloseRecordStream (recordStream *stream_p);
+
+/**
+ *
+ * @brief Parse the next record of the stream.
+ *
+ * @param  stream_p is a pointer to the stream.
+ * @param  record_p is where the record is stored.
+ * @return @c EXIT_SUCCESS if a record was read, @c EOF at the end of the
+ *         input. A trailing number without a string is returned with an
+ *         empty string.
+ *
+ */
+int NextRecord (recordStream *stream_p, recordView *record_p);
+
+/**
+ *
+ * @brief Compare a record against a user-supplied value.
+ *
+ * @b MatchRecord follows the rules of CompareItemsWithKey(): @p value_p
+ * points to an @c int for @c SINGLEINT, to a string for @c SINGLESTR and
+ * to a @c myData item for @c INT or @c STR.
+ *
+ * @return @c EQUAL if the record matches, @c NOTEQUAL otherwise.
+ *
+ */
+int MatchRecord (const recordView *record_p, const void *value_p, int key);
+
+/**
+ *
+ * @brief Call @p visit for every remaining record of the stream.
+ *
+ * @return number of records visited.
+ *
+ */
+long StreamRecords (recordStream *stream_p, recordVisitor visit,
+                    void *arg_p);
+
+/**
+ *
+ * @brief Advance the stream up to the next record that matches a value.
+ *
+ * @b StreamFind is the streaming version of FindInList(). Calling it
+ * again continues the search after the last match.
+ *
+ * @param  stream_p is a pointer to the stream.
+ * @param  value_p pointer to the value to match, see MatchRecord().
+ * @param  key which field of the record to match.
+ * @param  record_p is where the matching record is stored.
+ * @return @c EXIT_SUCCESS if a record was found, @c EXIT_FAILURE if the
+ *         end of the input was reached.
+ *
+ * @code
+ *  if (StreamFind(stream_p, "Donald", SINGLESTR, &record) == EXIT_SUCCESS)
+ *     printf("Found %d\n", record.number);
+ * @endcode
+ *
+ */
+int StreamFind (recordStream *stream_p, const void *value_p, int key,
+                recordView *record_p);
+
+/**
+ *
+ * @brief Call @p visit for every remaining record that matches a value.
+ *
+ * @return number of records that matched.
+ *
+ */
+long StreamFilter (recordStream *stream_p, const void *value_p, int key,
+                   recordVisitor visit, void *arg_p);
+
+/**
+ *
+ * @brief Count the remaining records that match a value.
+ *
+ * @return number of records that matched.
+ *
+ */
+long StreamCount (recordStream *stream_p, const void *value_p, int key);
+
+#endif
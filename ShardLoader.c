@@ -0,0 +1,235 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    ShardLoader.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 02:30 CST
+ *
+ * @brief   Implements the parallel loader of node files split in shards.
+ *
+ * References:
+ *          Uses the Glib thread pool functions.
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 02:30 CST -- File created
+ *          Mon 19 Oct 2026 07:20 CST -- A shard with a read error fails,
+ *                                       not only one that can't be opened
+ *
+ * @note    Every thread of the pool finds the last element of its list,
+ *          and checks whether it is sorted, while the list is still in its
+ *          cache. The merge keeps a binary heap of the shards ordered by
+ *          their first remaining item and moves links from the shard at the
+ *          top to the end of the result.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <stdio.h>                                /* Used for fprintf() */
+#include <glib.h>                   /* Used for the lists and the pool */
+#include "ShardLoader.h"                              /* Function header */
+#include "UserDefined.h"                   /* Used for CompareItems() */
+
+/* One shard, loaded by one task of the pool */
+typedef struct shard_{
+    const char * fileName;
+    GList      * head;                     /* Its list, NULL if empty    */
+    GList      * tail;
+    int          join;
+    int          failed;                   /* The file could not be read */
+    loadTimes    times;
+}shard;
+
+static void LoadShard (gpointer data, gpointer unused_p) {
+    shard *shard_p = data;
+    GList *l;
+    int    sorted = TRUE;
+
+    shard_p->times.records = -1;         /* Left as is if it is not read */
+    shard_p->head = LoadListSerial(shard_p->fileName, &shard_p->times);
+    if (shard_p->times.records < 0) {
+        shard_p->failed = TRUE;
+        return;
+    }
+    if (shard_p->head == NULL)
+        return;
+
+    for (l = shard_p->head; l->next != NULL; l = l->next)
+        sorted &= CompareItems(l->data, l->next->data) != GREATER;
+    if (shard_p->join == SHARD_MERGE && !sorted) {
+        shard_p->head = g_list_sort(shard_p->head,
+                                    (GCompareFunc)CompareItems);
+        l = g_list_last(shard_p->head);
+    }
+    shard_p->tail = l;
+}
+
+/* Whether the first item of shard a goes before that of shard b */
+static inline int Before (const shard *shards, int a, int b) {
+    int order = CompareItems(shards[a].head->data, shards[b].head->data);
+
+    return order == LESS || (order == EQUAL && a < b);
+}
+
+/* Move the shard at position i of the heap down to its place */
+static void SiftDown (const shard *shards, int *heap, int count, int i) {
+    int child, top = heap[i];
+
+    while ((child = 2 * i + 1) < count) {
+        if (child + 1 < count && Before(shards, heap[child + 1], heap[child]))
+            child++;
+        if (!Before(shards, heap[child], top))
+            break;
+        heap[i] = heap[child];
+        i = child;
+    }
+    heap[i] = top;
+}
+
+/* Merge the sorted lists of the shards, moving their links */
+static GList * MergeShards (shard *shards, int count) {
+    GList *theList_p = NULL, *tail_p = NULL, *link_p;
+    int   *heap = malloc(count * sizeof(int));
+    int    size = 0, i, s;
+
+    if (heap == NULL)
+        return NULL;
+    for (i = 0; i < count; i++)
+        if (shards[i].head != NULL)
+            heap[size++] = i;
+    for (i = size / 2 - 1; i >= 0; i--)
+        SiftDown(shards, heap, size, i);
+
+    while (size > 0) {
+        s = heap[0];
+        link_p = shards[s].head;
+        shards[s].head = link_p->next;
+        link_p->prev = tail_p;
+        if (tail_p == NULL)
+            theList_p = link_p;
+        else
+            tail_p->next = link_p;
+        tail_p = link_p;
+
+        if (shards[s].head == NULL)
+            heap[0] = heap[--size];                    /* Shard finished */
+        SiftDown(shards, heap, size, 0);
+    }
+    if (tail_p != NULL)
+        tail_p->next = NULL;
+    free(heap);
+    return theList_p;
+}
+
+/* Link the lists of the shards one after another */
+static GList * ConcatShards (shard *shards, int count) {
+    GList *theList_p = NULL, *tail_p = NULL;
+    int    i;
+
+    for (i = 0; i < count; i++) {
+        if (shards[i].head == NULL)
+            continue;
+        if (tail_p == NULL) {
+            theList_p = shards[i].head;
+        } else {
+            tail_p->next = shards[i].head;
+            shards[i].head->prev = tail_p;
+        }
+        tail_p = shards[i].tail;
+    }
+    return theList_p;
+}
+
+/**
+ * @brief Load many node files into one list with a pool of threads.
+ */
+GList * LoadShards (const char * const *fileNames, int shards, int threads,
+                    int join, loadTimes *shardTimes_p, loadTimes *total_p) {
+    shard       *shards_p;
+    GThreadPool *pool;
+    GList       *theList_p = NULL;
+    gint64       start = g_get_monotonic_time();
+    loadTimes    total = {0, 0, 0, 0, 0, 0};
+    int          i, failed = FALSE;
+
+    if (fileNames == NULL || shards <= 0)
+        return NULL;
+    shards_p = calloc(shards, sizeof(shard));
+    if (shards_p == NULL)
+        return NULL;
+    if (threads <= 0)
+        threads = g_get_num_processors();
+    pool = g_thread_pool_new(LoadShard, NULL, threads, FALSE, NULL);
+    if (pool == NULL) {
+        free(shards_p);
+        return NULL;
+    }
+
+    for (i = 0; i < shards; i++) {
+        shards_p[i].fileName = fileNames[i];
+        shards_p[i].join = join;
+        g_thread_pool_push(pool, &shards_p[i], NULL);
+    }
+    g_thread_pool_free(pool, FALSE, TRUE);      /* Waits for every shard */
+
+    for (i = 0; i < shards; i++) {
+        failed |= shards_p[i].failed;
+        if (shards_p[i].failed)
+            continue;
+        total.records += shards_p[i].times.records;
+        total.bytes += shards_p[i].times.bytes;
+        total.read += shards_p[i].times.read;
+        total.parse += shards_p[i].times.parse;
+        total.wait += shards_p[i].times.wait;
+        if (shardTimes_p != NULL)
+            shardTimes_p[i] = shards_p[i].times;
+    }
+
+    if (join == SHARD_MERGE)
+        theList_p = MergeShards(shards_p, shards);
+    else
+        theList_p = ConcatShards(shards_p, shards);
+    if (failed || (theList_p == NULL && total.records > 0)) {
+        /* A failed merge leaves the links of the shards as they were */
+        if (theList_p == NULL)
+            theList_p = ConcatShards(shards_p, shards);
+        DestroyList(theList_p);
+        g_list_free(theList_p);
+        theList_p = NULL;
+    }
+    free(shards_p);
+
+    total.wall = (g_get_monotonic_time() - start) / 1e6;
+    if (total_p != NULL)
+        *total_p = total;
+    return theList_p;
+}
+
+/**
+ * @brief Print the records, bytes and throughput of every shard and of the
+ * whole load.
+ */
+int PrintShardTimes (const char * const *fileNames, int shards,
+                     const loadTimes *shardTimes_p, const loadTimes *total_p,
+                     FILE *out) {
+    const loadTimes *t_p;
+    int              i;
+
+    if (total_p == NULL)
+        return EXIT_FAILURE;
+
+    for (i = 0; shardTimes_p != NULL && i < shards; i++) {
+        t_p = &shardTimes_p[i];
+        fprintf(out, "  %-20s %8ld records %10zu bytes %.6f s %8.1f MB/s\n",
+                fileNames[i], t_p->records, t_p->bytes, t_p->wall,
+                t_p->wall > 0 ? t_p->bytes / t_p->wall / 1e6 : 0.0);
+    }
+    fprintf(out, "Loaded %d shards, %ld records (%zu bytes) in %.6f s\n",
+            shards, total_p->records, total_p->bytes, total_p->wall);
+    fprintf(out, "  %.1f MB/s, %.0f records/s, serial estimate %.6f s\n",
+            total_p->wall > 0 ? total_p->bytes / total_p->wall / 1e6 : 0.0,
+            total_p->wall > 0 ? total_p->records / total_p->wall : 0.0,
+            total_p->read + total_p->parse);
+    return EXIT_SUCCESS;
+}
@@ -0,0 +1,93 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    ShardLoader.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Mon 19 Oct 2026 02:30 CST
+ *
+ * @brief   Declares a loader for node files split in many shards. The
+ *          shards are parsed at the same time by a pool of threads, each
+ *          one into its own list, and the lists are then joined into one,
+ *          in shard order or merged by number.
+ *
+ * References:
+ *          Uses the Glib thread pool and the loader in AsyncLoader.c.
+ *          D. E. Knuth, "The Art of Computer Programming", vol. 3, section
+ *          5.4.1 (multiway merging with a heap).
+ *
+ * Revision history:
+ *          Mon 19 Oct 2026 02:30 CST -- File created
+ *
+ * @note    Each shard is loaded with LoadListSerial(), so its timings are
+ *          those of a serial load, and the shards run in parallel with one
+ *          another. Joining only changes links: concatenating takes time
+ *          proportional to the number of shards once their ends are known,
+ *          and merging k shards takes O(n log k) comparisons.
+ *
+ */
+
+#ifndef SHARDLOADER_H
+#define SHARDLOADER_H
+
+#include <stdio.h>
+#include <glib.h>
+#include "AsyncLoader.h"
+
+/**
+ * @enum shardJoin
+ *
+ * @brief How the lists of the shards are joined.
+ */
+enum shardJoin {
+    SHARD_CONCAT,               /**< one after another, in shard order   */
+    SHARD_MERGE                 /**< merged by number, see LoadShards()  */
+};
+
+/**
+ *
+ * @brief Load many node files into one list with a pool of threads.
+ *
+ * With @c SHARD_MERGE the shards are expected to be sorted by number, as
+ * g_list_sort() with CompareItems() leaves them. A shard that is not is
+ * sorted by its own thread first, so the result is always sorted. Records
+ * with the same number keep the order of their shards.
+ *
+ * @param  fileNames paths of the node files.
+ * @param  shards number of files.
+ * @param  threads maximum number of threads loading at once, 0 to use the
+ *         number of processors.
+ * @param  join @c SHARD_CONCAT or @c SHARD_MERGE.
+ * @param  shardTimes_p array of @p shards where the timings of every
+ *         shard are stored, it may be NULL.
+ * @param  total_p where the total records and bytes, the sum of the read
+ *         and parse times and the elapsed time of the whole load are
+ *         stored, it may be NULL.
+ * @return pointer to the new list, NULL if a file could not be read, there
+ *         are no records or a thread could not be started.
+ *
+ * @code
+ *  theList_p = LoadShards(&argv[1], argc - 1, 0, SHARD_CONCAT,
+ *                         NULL, &total);
+ *  PrintLoadTimes(&total, stdout);
+ * @endcode
+ *
+ */
+GList * LoadShards (const char * const *fileNames, int shards, int threads,
+                    int join, loadTimes *shardTimes_p, loadTimes *total_p);
+
+/**
+ *
+ * @brief Print the records, bytes and throughput of every shard and of the
+ * whole load.
+ *
+ * @return @c EXIT_SUCCESS if the timings were printed, otherwise
+ *         @c EXIT_FAILURE.
+ *
+ */
+int PrintShardTimes (const char * const *fileNames, int shards,
+                     const loadTimes *shardTimes_p, const loadTimes *total_p,
+                     FILE *out);
+
+#endif
@@ -0,0 +1,358 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    SnapshotList.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 18:10 CST
+ *
+ * @brief   Implements a read-copy-update list of @c myData items with
+ *          epoch-based reclamation.
+ *
+ * References:
+ *          K. Fraser, "Practical lock-freedom", PhD thesis, 2004
+ *          (epoch-based reclamation).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 18:10 CST -- File created
+ *
+ * @note    The links are singly linked and published with release stores,
+ *          readers follow them with acquire loads. A reader records the
+ *          global epoch when it starts a read section. A removed link is
+ *          tagged with the epoch in which it was unlinked and it is freed
+ *          once every active reader started in a later epoch.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <stdatomic.h>                        /* Used for the atomics */
+#include <glib.h>                   /* Used for the writer mutex & yield */
+#include "SnapshotList.h"                             /* Function header */
+
+typedef struct snapNode_ snapNode;
+
+struct snapNode_{
+    _Atomic(snapNode *) next;              /* Followed by the readers    */
+    node_p              item;              /* User-defined data          */
+    snapNode          * retired;           /* Next in the limbo list     */
+    unsigned long       epoch;             /* Epoch when it was unlinked */
+};
+
+struct snapReader_{
+    snapshotList * list_p;
+    int            slot;
+};
+
+struct snapshotList_{
+    _Atomic(snapNode *)     head;
+    snapNode              * tail;           /* Only used by writers      */
+    _Atomic unsigned long   epoch;          /* Global epoch, starts at 1 */
+    _Atomic unsigned long   active[SNAP_MAXREADERS]; /* 0 if not reading */
+    _Atomic int             used[SNAP_MAXREADERS];   /* Registered slots */
+    snapReader              readers[SNAP_MAXREADERS];
+    GMutex                  writer;         /* Serializes the writers    */
+    snapNode              * limbo;          /* Removed, not yet freed    */
+    size_t                  pending;        /* Links in the limbo list   */
+};
+
+/**
+ * @brief Allocate an empty list.
+ */
+snapshotList * NewSnapshotList (void) {
+    snapshotList *list_p = calloc(1, sizeof(snapshotList));
+    int           i;
+
+    if (list_p == NULL)
+        return NULL;
+    atomic_init(&list_p->head, NULL);
+    atomic_init(&list_p->epoch, 1);
+    for (i = 0; i < SNAP_MAXREADERS; i++) {
+        atomic_init(&list_p->active[i], 0);
+        atomic_init(&list_p->used[i], FALSE);
+        list_p->readers[i].list_p = list_p;
+        list_p->readers[i].slot = i;
+    }
+    g_mutex_init(&list_p->writer);
+    return list_p;
+}
+
+/* Free a link and its item */
+static void FreeNode (snapNode *node_p) {
+    FreeItem(node_p->item);
+    free(node_p);
+}
+
+/**
+ * @brief De-allocate the list and every item in it.
+ */
+int DestroySnapshotList (snapshotList *list_p) {
+    snapNode *node_p, *next;
+    int       i;
+
+    if (list_p == NULL)
+        return EXIT_FAILURE;
+    for (i = 0; i < SNAP_MAXREADERS; i++)
+        if (atomic_load(&list_p->used[i]))
+            return EXIT_FAILURE;
+
+    for (node_p = atomic_load(&list_p->head); node_p != NULL; node_p = next) {
+        next = atomic_load_explicit(&node_p->next, memory_order_relaxed);
+        FreeNode(node_p);
+    }
+    for (node_p = list_p->limbo; node_p != NULL; node_p = next) {
+        next = node_p->retired;
+        FreeNode(node_p);
+    }
+    g_mutex_clear(&list_p->writer);
+    free(list_p);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Register the calling thread as a reader of the list.
+ */
+snapReader * SnapRegisterReader (snapshotList *list_p) {
+    int i, expected;
+
+    for (i = 0; i < SNAP_MAXREADERS; i++) {
+        expected = FALSE;
+        if (atomic_compare_exchange_strong(&list_p->used[i], &expected, TRUE))
+            return &list_p->readers[i];
+    }
+    return NULL;
+}
+
+/**
+ * @brief Unregister a reader.
+ */
+void SnapUnregisterReader (snapReader *reader_p) {
+    if (reader_p != NULL)
+        atomic_store(&reader_p->list_p->used[reader_p->slot], FALSE);
+}
+
+/**
+ * @brief Start a read section.
+ */
+void SnapReadLock (snapReader *reader_p) {
+    snapshotList *list_p = reader_p->list_p;
+
+    atomic_store_explicit(&list_p->active[reader_p->slot],
+                          atomic_load(&list_p->epoch), memory_order_relaxed);
+    /* Either the writer sees this reader or the reader sees the unlink */
+    atomic_thread_fence(memory_order_seq_cst);
+}
+
+/**
+ * @brief End a read section.
+ */
+void SnapReadUnlock (snapReader *reader_p) {
+    atomic_store_explicit(&reader_p->list_p->active[reader_p->slot], 0,
+                          memory_order_release);
+}
+
+/**
+ * @brief Find the first item that matches a value, inside a read section.
+ */
+node_p SnapFind (snapReader *reader_p, const void *value_p, int key) {
+    snapNode *node_p;
+
+    for (node_p = atomic_load_explicit(&reader_p->list_p->head,
+                                       memory_order_acquire);
+         node_p != NULL;
+         node_p = atomic_load_explicit(&node_p->next, memory_order_acquire))
+        if (CompareItemsWithKey(node_p->item, value_p, key) == EQUAL)
+            return node_p->item;
+    return NULL;
+}
+
+/**
+ * @brief Print every item with PrintItem(), inside a read section.
+ */
+int SnapPrint (snapReader *reader_p) {
+    snapNode *node_p;
+
+    node_p = atomic_load_explicit(&reader_p->list_p->head,
+                                  memory_order_acquire);
+    if (node_p == NULL)
+        return EXIT_FAILURE;
+    for (; node_p != NULL;
+         node_p = atomic_load_explicit(&node_p->next, memory_order_acquire))
+        if (PrintItem(node_p->item) == EXIT_FAILURE)
+            return EXIT_FAILURE;
+    return EXIT_SUCCESS;
+}
+
+/* Allocate a link that is not yet visible to the readers */
+static snapNode * NewNode (node_p item_p, snapNode *next) {
+    snapNode *node_p;
+
+    if (item_p == NULL)
+        return NULL;
+    node_p = malloc(sizeof(snapNode));
+    if (node_p != NULL) {
+        atomic_init(&node_p->next, next);
+        node_p->item = item_p;
+        node_p->retired = NULL;
+        node_p->epoch = 0;
+    }
+    return node_p;
+}
+
+/*
+ * Find the first link that matches a value and the pointer that points to
+ * it, with the writer mutex held.
+ */
+static snapNode * FindLink (snapshotList *list_p, const void *value_p,
+                            int key, _Atomic(snapNode *) **from_pp,
+                            snapNode **prev_pp) {
+    _Atomic(snapNode *) *from_p = &list_p->head;
+    snapNode            *prev = NULL;
+    snapNode            *node_p;
+
+    while ((node_p = atomic_load_explicit(from_p, memory_order_relaxed))
+           != NULL) {
+        if (CompareItemsWithKey(node_p->item, value_p, key) == EQUAL)
+            break;
+        prev = node_p;
+        from_p = &node_p->next;
+    }
+    *from_pp = from_p;
+    *prev_pp = prev;
+    return node_p;
+}
+
+/**
+ * @brief Insert an item at the end of the list.
+ */
+int SnapAppend (snapshotList *list_p, node_p item_p) {
+    snapNode *node_p = NewNode(item_p, NULL);
+
+    if (node_p == NULL)
+        return EXIT_FAILURE;
+    g_mutex_lock(&list_p->writer);
+    atomic_store_explicit(list_p->tail != NULL ? &list_p->tail->next
+                                               : &list_p->head,
+                          node_p, memory_order_release);
+    list_p->tail = node_p;
+    g_mutex_unlock(&list_p->writer);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Insert an item at the start of the list.
+ */
+int SnapPrepend (snapshotList *list_p, node_p item_p) {
+    snapNode *node_p = NewNode(item_p, NULL);
+
+    if (node_p == NULL)
+        return EXIT_FAILURE;
+    g_mutex_lock(&list_p->writer);
+    atomic_init(&node_p->next,
+                atomic_load_explicit(&list_p->head, memory_order_relaxed));
+    atomic_store_explicit(&list_p->head, node_p, memory_order_release);
+    if (list_p->tail == NULL)
+        list_p->tail = node_p;
+    g_mutex_unlock(&list_p->writer);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Insert an item before the first item that matches a value.
+ */
+int SnapInsertBefore (snapshotList *list_p, const void *value_p, int key,
+                      node_p item_p) {
+    _Atomic(snapNode *) *from_p;
+    snapNode            *prev, *sibling;
+    snapNode            *node_p = NewNode(item_p, NULL);
+
+    if (node_p == NULL)
+        return EXIT_FAILURE;
+    g_mutex_lock(&list_p->writer);
+    sibling = FindLink(list_p, value_p, key, &from_p, &prev);
+    if (sibling != NULL) {
+        atomic_init(&node_p->next, sibling);
+        atomic_store_explicit(from_p, node_p, memory_order_release);
+    }
+    g_mutex_unlock(&list_p->writer);
+
+    if (sibling == NULL) {
+        free(node_p);                          /* The caller keeps item_p */
+        return EXIT_FAILURE;
+    }
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Remove the first item that matches a value.
+ */
+int SnapRemove (snapshotList *list_p, const void *value_p, int key) {
+    _Atomic(snapNode *) *from_p;
+    snapNode            *prev, *node_p;
+
+    g_mutex_lock(&list_p->writer);
+    node_p = FindLink(list_p, value_p, key, &from_p, &prev);
+    if (node_p != NULL) {
+        /* Unlink; the removed link still points to the rest of the list */
+        atomic_store_explicit(from_p,
+                              atomic_load_explicit(&node_p->next,
+                                                   memory_order_relaxed),
+                              memory_order_release);
+        if (list_p->tail == node_p)
+            list_p->tail = prev;
+        atomic_thread_fence(memory_order_seq_cst);
+        node_p->epoch = atomic_fetch_add(&list_p->epoch, 1);
+        node_p->retired = list_p->limbo;
+        list_p->limbo = node_p;
+        list_p->pending++;
+    }
+    g_mutex_unlock(&list_p->writer);
+
+    if (node_p == NULL)
+        return EXIT_FAILURE;
+    SnapReclaim(list_p);
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Free the removed items that no reader can see anymore.
+ */
+size_t SnapReclaim (snapshotList *list_p) {
+    snapNode     **link_pp, *node_p;
+    unsigned long  oldest, epoch;
+    size_t         pending;
+    int            i;
+
+    g_mutex_lock(&list_p->writer);
+    atomic_thread_fence(memory_order_seq_cst);
+    oldest = atomic_load(&list_p->epoch);
+    for (i = 0; i < SNAP_MAXREADERS; i++) {
+        epoch = atomic_load_explicit(&list_p->active[i],
+                                     memory_order_acquire);
+        if (epoch != 0 && epoch < oldest)
+            oldest = epoch;
+    }
+
+    /* Readers that started after a link's epoch cannot reach it */
+    link_pp = &list_p->limbo;
+    while ((node_p = *link_pp) != NULL) {
+        if (node_p->epoch < oldest) {
+            *link_pp = node_p->retired;
+            FreeNode(node_p);
+            list_p->pending--;
+        } else {
+            link_pp = &node_p->retired;
+        }
+    }
+    pending = list_p->pending;
+    g_mutex_unlock(&list_p->writer);
+    return pending;
+}
+
+/**
+ * @brief Wait until every removed item has been freed.
+ */
+void SnapSynchronize (snapshotList *list_p) {
+    while (SnapReclaim(list_p) > 0)
+        g_thread_yield();
+}
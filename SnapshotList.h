@@ -0,0 +1,203 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    SnapshotList.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 18:10 CST
+ *
+ * @brief   Declares a read-copy-update list of @c myData items: readers
+ *          traverse it without taking any lock while a writer inserts and
+ *          removes items, and removed memory is reclaimed with epochs.
+ *
+ * References:
+ *          P. E. McKenney and J. D. Slingwine, "Read-copy update: using
+ *          execution history to solve concurrency problems", PDCS 1998.
+ *          K. Fraser, "Practical lock-freedom", PhD thesis, 2004
+ *          (epoch-based reclamation).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 18:10 CST -- File created
+ *
+ * @warning Every reader thread must register once and call the reader
+ *          functions between SnapReadLock() and SnapReadUnlock(). Items
+ *          returned by SnapFind() are only valid until SnapReadUnlock().
+ *
+ * @note    A traversal never sees a freed item and never sees an item
+ *          twice. Items inserted or removed while it runs may or may not
+ *          be seen, which is the usual RCU guarantee. Writers are
+ *          serialized among themselves but never wait for readers.
+ *
+ */
+
+#ifndef SNAPSHOTLIST_H
+#define SNAPSHOTLIST_H
+
+#include "UserDefined.h"
+
+/** @def  SNAP_MAXREADERS
+ * @brief Maximum number of readers registered at the same time.
+ */
+#define SNAP_MAXREADERS 64
+
+/**
+ * @typedef snapshotList
+ *
+ * @brief Opaque read-copy-update list.
+ */
+typedef struct snapshotList_ snapshotList;
+
+/**
+ * @typedef snapReader
+ *
+ * @brief Opaque handle of a registered reader.
+ */
+typedef struct snapReader_ snapReader;
+
+/**
+ *
+ * @brief Allocate an empty list.
+ *
+ * @return pointer to the new list or NULL if there is no memory.
+ *
+ */
+snapshotList * NewSnapshotList (void);
+
+/**
+ *
+ * @brief De-allocate the list and every item in it, including the ones
+ * waiting to be reclaimed.
+ *
+ * @return @c EXIT_SUCCESS if it was destroyed, @c EXIT_FAILURE if there
+ *         are readers still registered (nothing is freed).
+ *
+ */
+int DestroySnapshotList (snapshotList *list_p);
+
+/**
+ *
+ * @brief Register the calling thread as a reader of the list.
+ *
+ * @return pointer to the reader handle or NULL if there are already
+ *         @c SNAP_MAXREADERS readers.
+ *
+ */
+snapReader * SnapRegisterReader (snapshotList *list_p);
+
+/**
+ *
+ * @brief Unregister a reader. It must not be inside a read section.
+ *
+ */
+void SnapUnregisterReader (snapReader *reader_p);
+
+/**
+ *
+ * @brief Start a read section. Items seen until SnapReadUnlock() are not
+ * reclaimed.
+ *
+ */
+void SnapReadLock (snapReader *reader_p);
+
+/**
+ *
+ * @brief End a read section.
+ *
+ */
+void SnapReadUnlock (snapReader *reader_p);
+
+/**
+ *
+ * @brief Find the first item that matches a value, inside a read section.
+ *
+ * @param  reader_p is the handle of the reader.
+ * @param  value_p pointer to the user-defined data value to match.
+ * @param  key which field to match, as in FindInList().
+ * @return pointer to the item or NULL if no match was found.
+ *
+ * @code
+ *  SnapReadLock(reader_p);
+ *  aNode_p = SnapFind(reader_p, "Donald", SINGLESTR);
+ *  if (aNode_p != NULL)
+ *     PrintItem(aNode_p);
+ *  SnapReadUnlock(reader_p);
+ * @endcode
+ *
+ */
+node_p SnapFind (snapReader *reader_p, const void *value_p, int key);
+
+/**
+ *
+ * @brief Print every item with PrintItem(), inside a read section.
+ *
+ * @return @c EXIT_SUCCESS if the list was printed, otherwise
+ *         @c EXIT_FAILURE.
+ *
+ */
+int SnapPrint (snapReader *reader_p);
+
+/**
+ *
+ * @brief Insert an item at the end of the list.
+ *
+ * @return @c EXIT_SUCCESS if it was inserted, otherwise @c EXIT_FAILURE.
+ *
+ */
+int SnapAppend (snapshotList *list_p, node_p item_p);
+
+/**
+ *
+ * @brief Insert an item at the start of the list.
+ *
+ * @return @c EXIT_SUCCESS if it was inserted, otherwise @c EXIT_FAILURE.
+ *
+ */
+int SnapPrepend (snapshotList *list_p, node_p item_p);
+
+/**
+ *
+ * @brief Insert an item before the first item that matches a value.
+ *
+ * @return @c EXIT_SUCCESS if it was inserted, @c EXIT_FAILURE if no item
+ *         matches the value (nothing is inserted).
+ *
+ */
+int SnapInsertBefore (snapshotList *list_p, const void *value_p, int key,
+                      node_p item_p);
+
+/**
+ *
+ * @brief Remove the first item that matches a value.
+ *
+ * @b SnapRemove() unlinks the item at once. The item and its link are
+ * freed later, once every reader that could still see them has left its
+ * read section.
+ *
+ * @return @c EXIT_SUCCESS if an item was removed, otherwise
+ *         @c EXIT_FAILURE.
+ *
+ */
+int SnapRemove (snapshotList *list_p, const void *value_p, int key);
+
+/**
+ *
+ * @brief Free the removed items that no reader can see anymore.
+ *
+ * @b SnapReclaim() is also called by SnapRemove(), it never waits.
+ *
+ * @return number of removed items still waiting to be freed.
+ *
+ */
+size_t SnapReclaim (snapshotList *list_p);
+
+/**
+ *
+ * @brief Wait until every removed item has been freed.
+ *
+ * @warning Must not be called from inside a read section.
+ *
+ */
+void SnapSynchronize (snapshotList *list_p);
+
+#endif
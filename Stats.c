@@ -0,0 +1,173 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Stats.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 10:12 CST
+ *
+ * @brief   Implements the optional instrumentation layer: operation
+ *          counters and latency histograms.
+ *
+ * References:
+ *          Based on my own code.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 10:12 CST -- File created
+ *
+ * @note    Counters and histograms are updated with relaxed atomic
+ *          operations so they can be used from several threads. When the
+ *          @c STATS compiler flag is not set only stubs are compiled.
+ *
+ */
+
+#include <stdlib.h>                        /* Used for the EXIT codes */
+#include <stdio.h>                           /* Used for fprintf() */
+#include "Stats.h"                                 /* Function header */
+
+#ifdef STATS
+
+_Atomic unsigned long long statsCounters[STATS_NUM_COUNTERS];
+
+static _Atomic unsigned long long histogram[STATS_NUM_OPS][STATS_NUM_BUCKETS];
+static _Atomic unsigned long long totalTime[STATS_NUM_OPS];
+
+static const char *counterNames[STATS_NUM_COUNTERS] = {
+   "FindInList calls", "FindInList nodes visited", "Comparator calls",
+   "Allocations", "Bytes parsed", "Tokens parsed"
+};
+
+static const char *opNames[STATS_NUM_OPS] = {
+   "FindInList", "NewItem", "CopyList", "GetInt", "GetString"
+};
+
+/*
+ * Bucket b holds the samples in [2^b, 2^(b+1)) nanoseconds; bucket 0 also
+ * holds the zero samples.
+ */
+static int BucketOf (unsigned long long nanoseconds) {
+   int b = 0;
+
+   while (nanoseconds > 1 && b < STATS_NUM_BUCKETS - 1) {
+      nanoseconds >>= 1;
+      b++;
+   }
+   return b;
+}
+
+/*
+ * Upper bound of the bucket that holds the requested fraction of samples.
+ */
+static unsigned long long Percentile (int op, unsigned long long samples,
+                                      double fraction) {
+   unsigned long long seen = 0;
+   int b;
+
+   for (b = 0; b < STATS_NUM_BUCKETS; b++) {
+      seen += atomic_load_explicit(&histogram[op][b], memory_order_relaxed);
+      if (seen > 0 && (double)seen >= fraction * samples)
+         break;
+   }
+   return 2ULL << b;
+}
+
+/**
+ * @brief Add one latency sample to the histogram of an operation.
+ */
+void StatsRecord (int op, unsigned long long nanoseconds) {
+   if (op < 0 || op >= STATS_NUM_OPS)
+      return;
+   atomic_fetch_add_explicit(&histogram[op][BucketOf(nanoseconds)], 1,
+                             memory_order_relaxed);
+   atomic_fetch_add_explicit(&totalTime[op], nanoseconds,
+                             memory_order_relaxed);
+}
+
+/**
+ * @brief Read the current value of one of the counters.
+ */
+unsigned long long StatsGet (int counter) {
+   if (counter < 0 || counter >= STATS_NUM_COUNTERS)
+      return 0;
+   return atomic_load_explicit(&statsCounters[counter],
+                               memory_order_relaxed);
+}
+
+/**
+ * @brief Clear all the counters and latency histograms.
+ */
+void StatsReset (void) {
+   int i, b;
+
+   for (i = 0; i < STATS_NUM_COUNTERS; i++)
+      atomic_store_explicit(&statsCounters[i], 0, memory_order_relaxed);
+   for (i = 0; i < STATS_NUM_OPS; i++) {
+      atomic_store_explicit(&totalTime[i], 0, memory_order_relaxed);
+      for (b = 0; b < STATS_NUM_BUCKETS; b++)
+         atomic_store_explicit(&histogram[i][b], 0, memory_order_relaxed);
+   }
+}
+
+/**
+ * @brief Print all the counters and latency histograms.
+ */
+int StatsDump (FILE *out) {
+   unsigned long long calls, samples, count;
+   int i, b;
+
+   fprintf(out, "Counters:\n");
+   for (i = 0; i < STATS_NUM_COUNTERS; i++)
+      fprintf(out, "  %-26s %llu\n", counterNames[i], StatsGet(i));
+
+   calls = StatsGet(STATS_FIND_CALLS);
+   if (calls > 0)
+      fprintf(out, "  %-26s %.2f\n", "Nodes visited per find",
+              (double)StatsGet(STATS_FIND_VISITED) / calls);
+
+   fprintf(out, "Latency (ns):\n");
+   for (i = 0; i < STATS_NUM_OPS; i++) {
+      samples = 0;
+      for (b = 0; b < STATS_NUM_BUCKETS; b++)
+         samples += atomic_load_explicit(&histogram[i][b],
+                                         memory_order_relaxed);
+      if (samples == 0)
+         continue;
+
+      fprintf(out, "  %-10s n=%llu mean=%.1f p50<%llu p99<%llu\n",
+              opNames[i], samples,
+              (double)atomic_load_explicit(&totalTime[i],
+                                           memory_order_relaxed) / samples,
+              Percentile(i, samples, 0.50), Percentile(i, samples, 0.99));
+      for (b = 0; b < STATS_NUM_BUCKETS; b++) {
+         count = atomic_load_explicit(&histogram[i][b],
+                                      memory_order_relaxed);
+         if (count > 0)
+            fprintf(out, "    [%llu, %llu) %llu\n",
+                    b == 0 ? 0ULL : 1ULL << b, 2ULL << b, count);
+      }
+   }
+   return EXIT_SUCCESS;
+}
+
+#else
+
+void StatsRecord (int op, unsigned long long nanoseconds) {
+   (void)op;
+   (void)nanoseconds;
+}
+
+unsigned long long StatsGet (int counter) {
+   (void)counter;
+   return 0;
+}
+
+void StatsReset (void) {
+}
+
+int StatsDump (FILE *out) {
+   fprintf(out, "Statistics were not compiled in (use -DSTATS)\n");
+   return EXIT_FAILURE;
+}
+
+#endif
@@ -0,0 +1,143 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Stats.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 10:12 CST
+ *
+ * @brief   Optional instrumentation layer: operation counters and latency
+ *          histograms for the hot paths in UserDefined.c and FileIO.c.
+ *
+ * References:
+ *          Based on my own code.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 10:12 CST -- File created
+ *
+ * @note    Instrumentation is only compiled in when the @c STATS compiler
+ *          flag is set (e.g. @c -DSTATS). Otherwise every macro expands to
+ *          nothing and the instrumented functions are unchanged.
+ *
+ */
+
+#ifndef STATS_H
+#define STATS_H
+
+#include <stdio.h>
+
+/**
+ * @enum statsCounter
+ *
+ * @brief Identifies each of the event counters kept by the
+ * instrumentation layer.
+ */
+enum statsCounter {
+   STATS_FIND_CALLS,          /**< Calls to FindInList()                  */
+   STATS_FIND_VISITED,        /**< Nodes visited by FindInList()          */
+   STATS_COMPARES,            /**< Comparator invocations                 */
+   STATS_ALLOCS,              /**< Allocations in NewItem() & CopyList()  */
+   STATS_BYTES_PARSED,        /**< Bytes read by GetInt() & GetString()   */
+   STATS_TOKENS_PARSED,       /**< Tokens returned by the parser          */
+   STATS_NUM_COUNTERS
+};
+
+/**
+ * @enum statsOp
+ *
+ * @brief Identifies the operations that have a latency histogram.
+ */
+enum statsOp {
+   OP_FIND, OP_NEWITEM, OP_COPYLIST, OP_GETINT, OP_GETSTRING,
+   STATS_NUM_OPS
+};
+
+/** @def  STATS_NUM_BUCKETS
+ * @brief Number of log2(nanoseconds) buckets in each latency histogram.
+ */
+#define STATS_NUM_BUCKETS 40
+
+#ifdef STATS
+
+#include <stdatomic.h>
+#include <time.h>
+
+extern _Atomic unsigned long long statsCounters[STATS_NUM_COUNTERS];
+
+#define STATS_ADD(counter, n) \
+   atomic_fetch_add_explicit(&statsCounters[(counter)], (n), \
+                             memory_order_relaxed)
+#define STATS_INC(counter)     STATS_ADD((counter), 1)
+#define STATS_TIMER(name)      unsigned long long name = StatsNow()
+#define STATS_RECORD(op, name) StatsRecord((op), StatsNow() - (name))
+
+/**
+ * @brief Monotonic time stamp in nanoseconds used by the latency timers.
+ */
+static inline unsigned long long StatsNow (void) {
+   struct timespec ts;
+
+   clock_gettime(CLOCK_MONOTONIC, &ts);
+   return (unsigned long long)ts.tv_sec * 1000000000ULL + ts.tv_nsec;
+}
+
+#else
+
+#define STATS_ADD(counter, n)  ((void)0)
+#define STATS_INC(counter)     ((void)0)
+#define STATS_TIMER(name)      ((void)0)
+#define STATS_RECORD(op, name) ((void)0)
+
+#endif
+
+/**
+ *
+ * @brief Add one latency sample to the histogram of an operation.
+ *
+ * @b StatsRecord is normally called through the @c STATS_RECORD macro.
+ *
+ * @param  op is the operation, an enum of type @c statsOp.
+ * @param  nanoseconds is the measured latency.
+ *
+ */
+void StatsRecord (int op, unsigned long long nanoseconds);
+
+/**
+ *
+ * @brief Read the current value of one of the counters.
+ *
+ * @param  counter is an enum of type @c statsCounter.
+ * @return the counter value, always 0 if @c STATS is not set.
+ *
+ */
+unsigned long long StatsGet (int counter);
+
+/**
+ *
+ * @brief Clear all the counters and latency histograms.
+ *
+ */
+void StatsReset (void);
+
+/**
+ *
+ * @brief Print all the counters and latency histograms.
+ *
+ * @b StatsDump prints every counter, the average number of nodes visited
+ * per FindInList() call and, for each operation, the number of samples,
+ * the mean and approximate median and 99th percentile latencies, followed
+ * by the non-empty histogram buckets.
+ *
+ * @param  out is the stream where the report is written.
+ * @return @c EXIT_SUCCESS if the report was printed, @c EXIT_FAILURE if
+ *         the instrumentation was not compiled in.
+ *
+ * @code
+ *  StatsDump(stderr);
+ * @endcode
+ *
+ */
+int StatsDump (FILE *out);
+
+#endif
@@ -0,0 +1,251 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    TokenScan.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 19:05 CST
+ *
+ * @brief   Implements the byte classification kernels used by the node
+ *          file parser.
+ *
+ * References:
+ *          S. E. Anderson, "Bit Twiddling Hacks" (hasbetween).
+ *          D. Lemire, "Quickly parsing eight digits", 2022.
+ *          simdjson, "flatten_bits" (writing the set bits as positions).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 19:05 CST -- File created
+ *
+ * @note    The whole buffer is classified first, in a loop where the
+ *          blocks do not depend on each other, into one bitmap word per 64
+ *          bytes. The set bits are then written out as positions, so the
+ *          parser reads the next boundary instead of testing every byte,
+ *          which is what makes short tokens fast.
+ *
+ */
+
+#include <stdlib.h>                   /* Used for malloc & EXIT codes */
+#include <string.h>                   /* Used for memcpy() of the blocks */
+#include "TokenScan.h"                                /* Function header */
+
+#if defined(__AVX2__) || defined(__SSE2__)
+
+#include <immintrin.h>                     /* Used for the SIMD kernels */
+
+#if defined(__AVX2__)
+#define SCAN_KERNEL "AVX2"
+#define SCAN_BLOCK  32
+typedef __m256i     vector;
+#define VLOAD(p)      _mm256_loadu_si256((const __m256i *)(p))
+#define VSET(c)       _mm256_set1_epi8(c)
+#define VOR(a, b)     _mm256_or_si256(a, b)
+#define VAND(a, b)    _mm256_and_si256(a, b)
+#define VEQ(a, b)     _mm256_cmpeq_epi8(a, b)
+#define VGT(a, b)     _mm256_cmpgt_epi8(a, b)
+#define VMASK(a)      ((uint64_t)(uint32_t)_mm256_movemask_epi8(a))
+#else
+#define SCAN_KERNEL "SSE2"
+#define SCAN_BLOCK  16
+typedef __m128i     vector;
+#define VLOAD(p)      _mm_loadu_si128((const __m128i *)(p))
+#define VSET(c)       _mm_set1_epi8(c)
+#define VOR(a, b)     _mm_or_si128(a, b)
+#define VAND(a, b)    _mm_and_si128(a, b)
+#define VEQ(a, b)     _mm_cmpeq_epi8(a, b)
+#define VGT(a, b)     _mm_cmpgt_epi8(a, b)
+#define VMASK(a)      ((uint64_t)(uint32_t)_mm_movemask_epi8(a))
+#endif
+
+/*
+ * Bytes in [lo, hi]. The compare is signed, so bytes above 127 are
+ * negative and never fall in an ASCII range.
+ */
+static inline vector InRange (vector x, char lo, char hi) {
+    return VAND(VGT(x, VSET(lo - 1)), VGT(VSET(hi + 1), x));
+}
+
+/* Classify one block, the bits of byte i are shifted to bit shift + i */
+static inline void Classify (const char *block_p, int shift, uint64_t *digit,
+                             uint64_t *letter, uint64_t *hash,
+                             uint64_t *minus) {
+    vector x = VLOAD(block_p);
+
+    *digit |= VMASK(InRange(x, '0', '9')) << shift;
+    *letter |= VMASK(InRange(VOR(x, VSET(0x20)), 'a', 'z')) << shift;
+    *hash |= VMASK(VEQ(x, VSET('#'))) << shift;
+    *minus |= VMASK(VEQ(x, VSET('-'))) << shift;
+}
+
+#else
+
+#define SCAN_KERNEL "SWAR"
+#define SCAN_BLOCK  8
+
+/* Byte pattern repeated over a word */
+#define ONES       0x0101010101010101ULL
+#define HIGHBITS   (ONES * 0x80)
+#define LOWBITS    (ONES * 0x7F)
+
+/* High bit of every byte x with m < x < n, for 0 <= m <= 127, n <= 128 */
+static inline uint64_t Between (uint64_t x, unsigned m, unsigned n) {
+    return (ONES * (127 + n) - (x & LOWBITS)) & ~x &
+           ((x & LOWBITS) + ONES * (127 - m)) & HIGHBITS;
+}
+
+/* Gather the high bit of byte i into bit i */
+static inline uint64_t Gather (uint64_t m) {
+    return ((m >> 7) * 0x0102040810204080ULL) >> 56;
+}
+
+/* Classify one block, the bits of byte i are shifted to bit shift + i */
+static inline void Classify (const char *block_p, int shift, uint64_t *digit,
+                             uint64_t *letter, uint64_t *hash,
+                             uint64_t *minus) {
+    uint64_t x;
+
+    memcpy(&x, block_p, sizeof(x));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+    x = __builtin_bswap64(x);                  /* Byte i at bits 8i..8i+7 */
+#endif
+    *digit |= Gather(Between(x, '0' - 1, '9' + 1)) << shift;
+    *letter |= Gather(Between(x | ONES * 0x20, 'a' - 1, 'z' + 1)) << shift;
+    *hash |= Gather(Between(x, '#' - 1, '#' + 1)) << shift;
+    *minus |= Gather(Between(x, '-' - 1, '-' + 1)) << shift;
+}
+
+#endif
+
+/**
+ * @brief Allocate an empty index.
+ */
+tokenIndex * NewTokenIndex (void) {
+    return calloc(1, sizeof(tokenIndex));
+}
+
+/**
+ * @brief De-allocate an index.
+ */
+void FreeTokenIndex (tokenIndex *index_p) {
+    if (index_p != NULL) {
+        free(index_p->boundary);
+        free(index_p);
+    }
+}
+
+/* Boundaries of 64 bytes, carry_p holds the last digit and letter bits */
+static inline uint64_t Boundaries (const char *word_p, uint64_t *carry_p) {
+    uint64_t digit = 0, letter = 0, hash = 0, minus = 0, bits;
+    int      i;
+
+    for (i = 0; i < 64; i += SCAN_BLOCK)
+        Classify(word_p + i, i, &digit, &letter, &hash, &minus);
+
+    /* A run starts or ends where a byte differs from the one before it */
+    bits = (digit ^ (digit << 1 | (*carry_p & 1))) |
+           (letter ^ (letter << 1 | *carry_p >> 1)) | hash | minus;
+    *carry_p = digit >> 63 | (letter >> 63) << 1;
+    return bits;
+}
+
+/* Write the positions of the set bits, 8 at a time to avoid branches */
+static inline uint32_t * Flatten (uint32_t *out_p, uint32_t base,
+                                  uint64_t bits) {
+    int count = __builtin_popcountll(bits);
+    int i;
+
+    for (i = 0; i < 8; i++) {
+        out_p[i] = base + __builtin_ctzll(bits | 1ULL << 63);
+        bits &= bits - 1;
+    }
+    for (; i < count; i++) {
+        out_p[i] = base + __builtin_ctzll(bits);
+        bits &= bits - 1;
+    }
+    return out_p + count;
+}
+
+/**
+ * @brief Find the token boundaries of a buffer.
+ */
+int IndexTokens (tokenIndex *index_p, const char *buffer_p, size_t length) {
+    size_t    words = length / 64, w;
+    size_t    needed = length + 64;            /* Flatten() writes ahead */
+    uint32_t *out_p, *bigger;
+    uint64_t  carry = 0, bits;
+    char      last[64];
+
+    index_p->count = index_p->next = index_p->length = 0;
+    if (needed > index_p->capacity) {
+        bigger = realloc(index_p->boundary, needed * sizeof(uint32_t));
+        if (bigger == NULL)
+            return EXIT_FAILURE;
+        index_p->boundary = bigger;
+        index_p->capacity = needed;
+    }
+
+    out_p = index_p->boundary;
+    for (w = 0; w < words; w++)
+        out_p = Flatten(out_p, 64 * w, Boundaries(buffer_p + 64 * w, &carry));
+
+    if (64 * words < length) {          /* The last bytes, zero padded */
+        memset(last, 0, sizeof(last));
+        memcpy(last, buffer_p + 64 * words, length - 64 * words);
+        bits = Boundaries(last, &carry);
+        bits &= (1ULL << (length - 64 * words)) - 1;
+        out_p = Flatten(out_p, 64 * words, bits);
+    }
+
+    index_p->count = out_p - index_p->boundary;
+    index_p->length = length;
+    return EXIT_SUCCESS;
+}
+
+/**
+ * @brief Find the first boundary at or after a position.
+ */
+size_t NextBoundary (tokenIndex *index_p, size_t from) {
+    size_t next = index_p->next;
+
+    while (next > 0 && index_p->boundary[next - 1] >= from)
+        next--;
+    while (next < index_p->count && index_p->boundary[next] < from)
+        next++;
+    index_p->next = next;
+    return next < index_p->count ? index_p->boundary[next]
+                                 : index_p->length;
+}
+
+/**
+ * @brief Append decimal digits to a value, eight at a time.
+ */
+unsigned int ParseDigits (unsigned int value, const char *buffer_p,
+                          size_t length) {
+    static const unsigned int scale[9] = {1, 10, 100, 1000, 10000, 100000,
+                                          1000000, 10000000, 100000000};
+    uint64_t chunk;
+    size_t   n;
+
+    for (; length > 0; buffer_p += n, length -= n) {
+        n = length < 8 ? length : 8;
+        memcpy(&chunk, buffer_p, sizeof(chunk));
+#if defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+        chunk = __builtin_bswap64(chunk);   /* First digit in the low byte */
+#endif
+        /* Bytes after the digits are shifted out, zeros come in ahead */
+        chunk = (chunk - 0x3030303030303030ULL) << (8 * (8 - n));
+        chunk = (chunk * 10 + (chunk >> 8)) & 0x00FF00FF00FF00FFULL;
+        chunk = (chunk * 100 + (chunk >> 16)) & 0x0000FFFF0000FFFFULL;
+        chunk = (chunk * 10000 + (chunk >> 32)) & 0xFFFFFFFFULL;
+        value = value * scale[n] + (unsigned int)chunk;
+    }
+    return value;
+}
+
+/**
+ * @brief Name of the kernel compiled in.
+ */
+const char * TokenScanKernel (void) {
+    return SCAN_KERNEL;
+}
@@ -0,0 +1,122 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    TokenScan.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 19:05 CST
+ *
+ * @brief   Declares the byte classification kernels used by the node file
+ *          parser. A buffer is classified 16 or 32 bytes at a time to find
+ *          every position where a token may start or end, and the parser
+ *          jumps from one of those positions to the next.
+ *
+ * References:
+ *          G. Langdale and D. Lemire, "Parsing gigabytes of JSON per
+ *          second", VLDB Journal 28(6), 2019 (structural indexes).
+ *          S. E. Anderson, "Bit Twiddling Hacks" (hasbetween).
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 19:05 CST -- File created
+ *
+ * @note    The kernel is chosen when compiling: AVX2 if @c __AVX2__ is
+ *          defined (e.g. @c -mavx2 or @c -march=native), SSE2 on any other
+ *          x86-64 and a portable 64-bit SWAR version elsewhere. Digits and
+ *          letters are the ASCII ones, as isdigit() and isalpha() in the
+ *          "C" locale.
+ *
+ */
+
+#ifndef TOKENSCAN_H
+#define TOKENSCAN_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/**
+ * @struct tokenIndex
+ *
+ * @brief Boundaries of the tokens of a buffer, in increasing order.
+ *
+ * A boundary is the first byte of a run of digits or of letters, the first
+ * byte after such a run, and every @c '#' and @c '-'.
+ */
+typedef struct tokenIndex_{
+    uint32_t * boundary;        /**< positions of the boundaries          */
+    size_t     count;           /**< number of boundaries                 */
+    size_t     capacity;        /**< positions allocated                  */
+    size_t     length;          /**< number of bytes indexed              */
+    size_t     next;            /**< cursor used by NextBoundary()        */
+}tokenIndex;
+
+/**
+ *
+ * @brief Allocate an empty index.
+ *
+ * @return pointer to the index or NULL if there is no memory.
+ *
+ */
+tokenIndex * NewTokenIndex (void);
+
+/**
+ *
+ * @brief De-allocate an index.
+ *
+ */
+void FreeTokenIndex (tokenIndex *index_p);
+
+/**
+ *
+ * @brief Find the token boundaries of a buffer.
+ *
+ * @b IndexTokens() replaces the contents of the index with the boundaries
+ * of the @p length bytes at @p buffer_p, which must be less than 4 GiB.
+ *
+ * @return @c EXIT_SUCCESS if the buffer was indexed, @c EXIT_FAILURE if
+ *         there is no memory (the index is left empty).
+ *
+ * @code
+ *  IndexTokens(index_p, buffer_p, length);
+ *  start = NextBoundary(index_p, 0);
+ *  end = NextBoundary(index_p, start + 1);
+ * @endcode
+ *
+ */
+int IndexTokens (tokenIndex *index_p, const char *buffer_p, size_t length);
+
+/**
+ *
+ * @brief Find the first boundary at or after a position.
+ *
+ * @b NextBoundary() is fastest when it is called with increasing
+ * positions, it continues from where the previous call stopped.
+ *
+ * @return its position, or @c length if there is none.
+ *
+ */
+size_t NextBoundary (tokenIndex *index_p, size_t from);
+
+/**
+ *
+ * @brief Append decimal digits to a value, eight at a time.
+ *
+ * @b ParseDigits() returns @p value * 10^length plus the number written in
+ * the @p length digits at @p buffer_p. It wraps around like the loop in
+ * GetInt() does for numbers that do not fit.
+ *
+ * @warning It reads eight bytes at a time, so up to 7 bytes after the
+ *          digits must be readable. Their values are not used.
+ *
+ */
+unsigned int ParseDigits (unsigned int value, const char *buffer_p,
+                          size_t length);
+
+/**
+ *
+ * @brief Name of the kernel compiled in: "AVX2", "SSE2" or "SWAR".
+ *
+ */
+const char * TokenScanKernel (void);
+
+#endif
@@ -0,0 +1,121 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Traverse.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 21:00 CST
+ *
+ * @brief   Implements the prefetching traversal of lists.
+ *
+ * References:
+ *          C.-K. Luk and T. C. Mowry, "Compiler-based prefetching for
+ *          recursive data structures", ASPLOS VII, 1996.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 21:00 CST -- File created
+ *
+ * @note    Two cursors run ahead of the element being visited. The first
+ *          one walks the links and requests the @c myData they point to,
+ *          the second one follows it at half the distance, when that data
+ *          has arrived, and requests the string. Requests are hints, a
+ *          compiler without @c __builtin_prefetch() gets a plain loop.
+ *
+ */
+
+#include <stdlib.h>                          /* Used for the EXIT codes */
+#include <glib.h>                        /* Used for the list functions */
+#include "Traverse.h"                                 /* Function header */
+
+#if defined(__GNUC__)
+#define PREFETCH(address) __builtin_prefetch(address)
+#else
+#define PREFETCH(address) ((void)(address))
+#endif
+
+/* Cursors that run ahead of the element being visited */
+typedef struct ahead_{
+    GList * data;                          /* Request the data of this   */
+    GList * string;                        /* Request the string of this */
+}ahead;
+
+/* Request the data of one more element and the string of another one */
+static inline void StepAhead (ahead *ahead_p) {
+    node_p item_p;
+
+    if (ahead_p->data != NULL) {
+        PREFETCH(ahead_p->data->data);
+        ahead_p->data = ahead_p->data->next;
+    }
+    if (ahead_p->string != NULL) {
+        item_p = ahead_p->string->data;
+        if (item_p != NULL)
+            PREFETCH(item_p->theString);
+        ahead_p->string = ahead_p->string->next;
+    }
+}
+
+/* Place the cursors at their distances from the start of a list */
+static inline void StartAhead (ahead *ahead_p, GList *myList_p) {
+    int i;
+
+    ahead_p->data = ahead_p->string = myList_p;
+    for (i = 0; i < TRAVERSE_AHEAD / 2; i++) {
+        if (ahead_p->data != NULL) {                 /* Data goes twice */
+            PREFETCH(ahead_p->data->data);
+            ahead_p->data = ahead_p->data->next;
+        }
+        StepAhead(ahead_p);
+    }
+}
+
+/**
+ * @brief Call a visitor for every element of a list, in order.
+ */
+GList * ListForEach (GList *myList_p, itemVisitor visit, void *arg_p) {
+    ahead  ahead;
+    GList *l;
+
+    StartAhead(&ahead, myList_p);
+    for (l = myList_p; l != NULL; l = l->next) {
+        StepAhead(&ahead);
+        if (visit(l->data, arg_p) != EXIT_SUCCESS)
+            break;
+    }
+    return l;
+}
+
+/**
+ * @brief Build a new list with the result of a function on every element.
+ */
+GList * ListMap (GList *myList_p, itemMapper map, void *arg_p) {
+    ahead   ahead;
+    GList  *l, *result_p = NULL;
+    node_p  item_p;
+
+    StartAhead(&ahead, myList_p);
+    for (l = myList_p; l != NULL; l = l->next) {
+        StepAhead(&ahead);
+        item_p = map(l->data, arg_p);
+        if (item_p != NULL)
+            result_p = g_list_prepend(result_p, item_p);
+    }
+    return g_list_reverse(result_p);            /* Linear, not quadratic */
+}
+
+/**
+ * @brief Combine every element of a list into one value.
+ */
+long ListReduce (GList *myList_p, itemReducer reduce, void *accumulator_p) {
+    ahead  ahead;
+    GList *l;
+    long   count = 0;
+
+    StartAhead(&ahead, myList_p);
+    for (l = myList_p; l != NULL; l = l->next, count++) {
+        StepAhead(&ahead);
+        reduce(accumulator_p, l->data);
+    }
+    return count;
+}
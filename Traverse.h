@@ -0,0 +1,131 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    Traverse.h
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @date    Sun 18 Oct 2026 21:00 CST
+ *
+ * @brief   Declares the traversal functions used by the list routines:
+ *          visit, map and reduce every @c myData element of a list.
+ *
+ * References:
+ *          T. C. Mowry, M. S. Lam and A. Gupta, "Design and evaluation of
+ *          a compiler algorithm for prefetching", ASPLOS V, 1992.
+ *          C.-K. Luk and T. C. Mowry, "Compiler-based prefetching for
+ *          recursive data structures", ASPLOS VII, 1996.
+ *
+ * Revision history:
+ *          Sun 18 Oct 2026 21:00 CST -- File created
+ *
+ * @note    While an element is visited the traversal asks the processor
+ *          for the @c myData of the element @c TRAVERSE_AHEAD places ahead
+ *          and for the string of the element half that distance ahead. On
+ *          lists that do not fit in the cache the visits overlap with
+ *          those memory accesses instead of waiting for each one of them.
+ *          The links themselves cannot be requested early, each one is
+ *          only known when the previous one arrives, so a list whose links
+ *          are scattered in memory (e.g. after g_list_sort()) is still
+ *          limited by the time to load one link per element.
+ *
+ */
+
+#ifndef TRAVERSE_H
+#define TRAVERSE_H
+
+#include <glib.h>
+#include "UserDefined.h"
+
+/** @def  TRAVERSE_AHEAD
+ * @brief Distance, in elements, from the element being visited to the
+ * one whose data is requested.
+ */
+#ifndef TRAVERSE_AHEAD
+#define TRAVERSE_AHEAD 16
+#endif
+
+/**
+ * @typedef itemVisitor
+ *
+ * @brief Function called once per element. Return @c EXIT_SUCCESS to keep
+ * going, any other value stops the traversal.
+ */
+typedef int (*itemVisitor)(node_p item_p, void *arg_p);
+
+/**
+ * @typedef itemMapper
+ *
+ * @brief Function that makes the data of the element of a new list from
+ * the data of an element, or returns NULL to leave it out.
+ */
+typedef node_p (*itemMapper)(node_p item_p, void *arg_p);
+
+/**
+ * @typedef itemReducer
+ *
+ * @brief Function that adds an element to the value at @p accumulator_p.
+ */
+typedef void (*itemReducer)(void *accumulator_p, node_p item_p);
+
+/**
+ *
+ * @brief Call a visitor for every element of a list, in order.
+ *
+ * @param  myList_p pointer to the list.
+ * @param  visit function called with the data of each element and
+ *         @p arg_p.
+ * @param  arg_p pointer passed to @p visit.
+ * @return pointer to the element where @p visit stopped the traversal,
+ *         or NULL if every element was visited.
+ *
+ * @code
+ *  if (ListForEach(theList_p, PrintVisitor, NULL) != NULL)
+ *     printf("Error printing the list\n");
+ * @endcode
+ *
+ * @warning @p visit may de-allocate the data of the element it is given
+ *          but not change the links of the list.
+ *
+ */
+GList * ListForEach (GList *myList_p, itemVisitor visit, void *arg_p);
+
+/**
+ *
+ * @brief Build a new list with the result of a function on every element.
+ *
+ * @b ListMap() builds the new list in linear time, in the same order as
+ * @p myList_p. Elements for which @p map returns NULL are left out, so it
+ * also filters.
+ *
+ * @param  myList_p pointer to the list.
+ * @param  map function that returns the data of the new element.
+ * @param  arg_p pointer passed to @p map.
+ * @return pointer to the new list, NULL if it is empty.
+ *
+ * @code
+ *  theCopy_p = ListMap(theList_p, CopyMapper, NULL);
+ * @endcode
+ *
+ */
+GList * ListMap (GList *myList_p, itemMapper map, void *arg_p);
+
+/**
+ *
+ * @brief Combine every element of a list into one value.
+ *
+ * @param  myList_p pointer to the list.
+ * @param  reduce function that adds each element to @p accumulator_p.
+ * @param  accumulator_p pointer to the value, it holds the initial value
+ *         and the result.
+ * @return number of elements reduced.
+ *
+ * @code
+ *  long total = 0;
+ *  ListReduce(theList_p, AddNumber, &total);
+ * @endcode
+ *
+ */
+long ListReduce (GList *myList_p, itemReducer reduce, void *accumulator_p);
+
+#endif
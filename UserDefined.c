@@ -21,6 +21,16 @@
  *          Tue 10 May 2016 12:07 DST -- Added CompareItems function to
  *                          implement sort using g_list_sort()
  *          Fri 20 May 2016 22:09 DST -- Changed DoxyGen comments
+ *          Sun 18 Oct 2026 10:12 CST -- Added optional instrumentation
+ *                          counters (compile with -DSTATS)
+ *          Sun 18 Oct 2026 13:02 CST -- Added FindManyInList function
+ *          Sun 18 Oct 2026 14:50 CST -- Added RemoveFromList and
+ *                          RemoveIfInList functions
+ *          Sun 18 Oct 2026 21:00 CST -- PrintList, DestroyList, CopyList
+ *                          and FindInList use the traversal functions in
+ *                          Traverse.h, CopyList takes linear time
+ *          Mon 19 Oct 2026 06:50 CST -- FindManyInList records its
+ *                          latency with the other finds
  *
  * @warning If there is not enough memory to create a node or a list
  *          the related functions indicate failure. If the DEBUG compiler
@@ -34,6 +44,8 @@
  */
 
 #include "UserDefined.h"
+#include "Stats.h"                   // Optional instrumentation counters
+#include "Traverse.h"                  // Prefetching traversal of lists
 
 /**
  *
@@ -60,6 +72,10 @@ int PrintItem (const void *data_p){
     }
 }
 
+static int PrintVisitor (node_p item_p, void *arg_p){
+    return PrintItem(item_p); // Stops the traversal if it fails
+}
+
 /**
  *
  * @brief Print all the elements of a list, based on a user-defined
@@ -84,18 +100,10 @@ int PrintItem (const void *data_p){
 int PrintList (GList * myList_p){
     if(myList_p == NULL)//
         return EXIT_FAILURE;
-    else{
-        GList * aux = myList_p;//Puntero auxiliar para recorrer la estructura
-        while(aux != NULL)//Recorremos la lista
-        {
-            if(PrintItem(aux->data)==EXIT_FAILURE)
-                return EXIT_FAILURE;
-
-            aux = aux->next;
-        }
-        
+    else if(ListForEach(myList_p, PrintVisitor, NULL) != NULL)//Recorremos la lista
+        return EXIT_FAILURE; // An element could not be printed
+    else
         return EXIT_SUCCESS;
-    }
 }
 
 /**
@@ -121,10 +129,13 @@ int PrintList (GList * myList_p){
  */
 
 node_p NewItem (int theNumber, char * theString){
+    STATS_TIMER(start);
     node_p newNode = (node_p)malloc(sizeof(struct myData_));
     newNode->number = theNumber;
     newNode->theString = strdup(theString);
 
+    STATS_ADD(STATS_ALLOCS, 2); // One for the node and one for the string
+    STATS_RECORD(OP_NEWITEM, start);
     return newNode;
 }
 
@@ -156,6 +167,11 @@ int FreeItem (const void *data_p){
     }
 }
 
+static int FreeVisitor (node_p item_p, void *arg_p)
+{
+    return FreeItem(item_p); // Stops the traversal if it fails
+}
+
 /**
  *
  * @brief De-allocate memory assigned to each user-defined data structure
@@ -179,13 +195,8 @@ int DestroyList (GList * theList_p)
 {
     if(theList_p!=NULL)
     {
-		GList * l = NULL;  // We create a temporary pointer so that we can cycle through the list
-		for(l=theList_p;l!=NULL;l=l->next)
-        { // The for loop cycles through every member of our GList
-            node_p node = l->data; // We extract the data from the node (a node_p) and assign it to a pointer of type myData
-            if(FreeItem(node) == EXIT_FAILURE) // We pass the pointer to FreeItem so that the memory can be liberated 
-                return EXIT_FAILURE;	    								 
-	  	}
+        if(ListForEach(theList_p, FreeVisitor, NULL) != NULL) // Every node is passed to FreeItem so that the memory can be liberated
+            return EXIT_FAILURE;
 	  	return EXIT_SUCCESS; // We return success if everything is succesfull
 	}
     return EXIT_FAILURE; // In case the list is NULL we return a failure
@@ -218,6 +229,7 @@ int DestroyList (GList * theList_p)
  */
 int CompareItems (const void *item1_p, const void *item2_p)
 {
+    STATS_INC(STATS_COMPARES);
     //node_p node1 = item1_p,node2=item2_p; // We convert our generic void pointers to node_p pointers so that we can manage the structure
 	if(((node_p)item1_p)->number < ((node_p)item2_p)->number) // We compare the numbers of the nodes to see if node 1 is less
 		return LESS; // We return the enum value LESS 
@@ -264,6 +276,8 @@ int CompareItemsWithKey (const void *item1_p, const void *item2_p, int key)
     //node_p node1=item1_p,node2 = item2_p; // We assume our parameters passed are going to be node_p pointers.
 	//int *integer = NULL; //We declare an integer pointer and a char pointer in case the above statement is not true
 	//char *string = NULL;
+	if(key != INT) // The INT case is counted by CompareItems
+		STATS_INC(STATS_COMPARES);
 	switch(key)
     { // A switch statement lets us handle each key type individually
 		case INT: // INT key case
@@ -293,6 +307,12 @@ int CompareItemsWithKey (const void *item1_p, const void *item2_p, int key)
     }
 }
 
+static node_p CopyMapper (node_p node, void *arg_p)
+{
+    STATS_INC(STATS_ALLOCS); // The list link
+    return NewItem(node->number, node->theString); // We create a new memory location for the copy of the node, copying the same data from the node that comes from the original list
+}
+
 /**
  *
  * @brief Perform a deep copy of an input list.
@@ -316,21 +336,29 @@ int CompareItemsWithKey (const void *item1_p, const void *item2_p, int key)
  */
 GList * CopyList (GList * inputList)
 {
+	STATS_TIMER(start);
 	GList *theCopy = NULL; // We create an empty GList pointer that will be the starting point for our copy 
 	if(inputList!=NULL)
-    {
-        GList *l; // A temporary pointer is created that will allow us to cycle through our list
-        node_p aNode_p=NULL; // A temporary node is created that will let us append new nodes to the list
-        for(l=inputList;l!=NULL;l=l->next)
-        { // We cycle through the list
-            node_p node = l->data; // We extract the data from the current node (a node_p pointer) and assign it to a variable
-            aNode_p = NewItem(node->number, node->theString); // We create a new memory location for the copy of the node, copying the same data from the node that comes from the original list
-            theCopy = g_list_append(theCopy, aNode_p); // The new node created is appended to the copy of the list
-        }
-  	}
+        theCopy = ListMap(inputList, CopyMapper, NULL); // The copies are linked in the same order, in linear time
+  	STATS_RECORD(OP_COPYLIST, start);
   	return theCopy; // We return the pointer to the copy of the list, in case the input is NULL the pointer will also be NULL
 }
 
+/* Value searched by FindInList() and nodes visited so far */
+typedef struct findArg_{
+    const void *value_p;
+    int key;
+    unsigned long visited; // Only reported with -DSTATS
+}findArg;
+
+static int FindVisitor (node_p node, void *arg_p){
+    findArg *find_p = arg_p;
+    find_p->visited++;
+    if(CompareItemsWithKey(node,find_p->value_p,find_p->key) == EQUAL) // We compare the value needed in the node depending on what type of key the user passes
+        return EXIT_FAILURE; // Stops the traversal at our node
+    return EXIT_SUCCESS;
+}
+
 /**
  *
  * @brief Attempts to find a user-defined value in a list
@@ -359,13 +387,185 @@ GList * CopyList (GList * inputList)
  *
  */
 GList * FindInList (GList * myList_p, const void *value_p, int key){
-    GList *l = NULL; // We create a temporary pointer so that we can cycle through the list
-	node_p node = NULL; // We create a variable that will store the pointer to the data in each GList type
-	for(l=myList_p;l!=NULL;l=l->next)
-    { // We cycle through the list
-    	node = l->data; // The data is extracted and stored in the node variable
-    	if(CompareItemsWithKey(l->data,value_p,key) == 0) // We compare the value needed in the node depending oon what type of key the user passes. If the function returns zero we have found
-    	    return l;									// our node
-	}
-    return NULL; // In case the node isn't found we return null
-}
\ No newline at end of file
+    STATS_TIMER(start);
+    findArg find = {value_p, key, 0};
+    GList *l = ListForEach(myList_p, FindVisitor, &find); // In case the node isn't found the traversal ends with l == NULL
+    STATS_INC(STATS_FIND_CALLS);
+    STATS_ADD(STATS_FIND_VISITED, find.visited);
+    STATS_RECORD(OP_FIND, start);
+    return l;
+}
+
+/**
+ *
+ * @brief Find many user-defined values in a list with a single traversal.
+ *
+ * @b FindManyInList() answers @p count lookups at once. The values are
+ * placed in a hash table and the list is traversed only once, stopping
+ * as soon as every value has been found. For each value the result is the
+ * same element that FindInList() would return.
+ *
+ * @param  myList_p pointer to the list to be searched.
+ * @param  values_p pointer to an array of @p count values: @c int for
+ *         @p key = SINGLEINT or @c char* for @p key = SINGLESTR.
+ * @param  count number of values in @p values_p.
+ * @param  key either SINGLEINT or SINGLESTR.
+ * @param  found_p array of @p count pointers where the element that
+ *         matches each value is stored, NULL if it was not found.
+ * @return number of values found, or -1 if the key is not supported or
+ *         there is not enough memory.
+ *
+ * @code
+ *  const char *names[] = {"Huey", "Dewey", "Louie"};
+ *  GList *found[3];
+ *  if (FindManyInList(theList_p, names, 3, SINGLESTR, found) < 3)
+ *     printf("Error: failed to find some of the nodes \n");
+ * @endcode
+ *
+ * @note   The user must check if each returned pointer is NULL
+ *         before de-referencing it.
+ *
+ */
+int FindManyInList (GList * myList_p, const void *values_p, int count,
+                    int key, GList ** found_p){
+    STATS_TIMER(start);
+    GHashTable *needles = NULL; // Maps each value to the first index where it appears
+    int *nextSame = NULL; // Chains the indexes of repeated values
+    int remaining = 0; // Number of different values not found yet
+    int found = 0; // Number of values found
+    int i, index;
+    gpointer entry;
+    GList *l = NULL;
+    unsigned long visited = 0; // Nodes visited, only reported with -DSTATS
+
+    if(count <= 0)
+        return 0;
+    if(key == SINGLEINT)
+        needles = g_hash_table_new(g_int_hash, g_int_equal);
+    else if(key == SINGLESTR)
+        needles = g_hash_table_new(g_str_hash, g_str_equal);
+    else
+        return -1; // Only lookups by a single value are supported
+    nextSame = malloc(count * sizeof(int));
+    if(nextSame == NULL){
+        g_hash_table_destroy(needles);
+        return -1;
+    }
+
+    for(i = count - 1; i >= 0; i--)
+    { // Backwards so the chains keep the original order
+        const void *needle = key == SINGLEINT ? (const void *)&((const int *)values_p)[i]
+                                              : (const void *)((const char * const *)values_p)[i];
+        found_p[i] = NULL;
+        if(g_hash_table_lookup_extended(needles, needle, NULL, &entry))
+            nextSame[i] = GPOINTER_TO_INT(entry) - 1;
+        else{
+            nextSame[i] = -1;
+            remaining++;
+        }
+        g_hash_table_insert(needles, (gpointer)needle, GINT_TO_POINTER(i + 1)); // Stored +1 so that 0 is never used
+    }
+
+    for(l = myList_p; l != NULL && remaining > 0; l = l->next)
+    { // A single pass over the list, until every value has been found
+        node_p node = l->data;
+        visited++;
+        entry = key == SINGLEINT ? g_hash_table_lookup(needles, &node->number)
+                                 : g_hash_table_lookup(needles, node->theString);
+        if(entry == NULL)
+            continue;
+        index = GPOINTER_TO_INT(entry) - 1;
+        if(found_p[index] != NULL)
+            continue; // Only the first match counts, as in FindInList()
+        for(i = index; i >= 0; i = nextSame[i]){
+            found_p[i] = l;
+            found++;
+        }
+        remaining--;
+    }
+
+    (void)visited;
+    STATS_INC(STATS_FIND_CALLS);
+    STATS_ADD(STATS_FIND_VISITED, visited);
+    STATS_RECORD(OP_FIND, start); // One sample per call, as FindInList()
+    free(nextSame);
+    g_hash_table_destroy(needles);
+    return found;
+}
+
+/**
+ *
+ * @brief Remove an element from a list and de-allocate its user-defined
+ * data.
+ *
+ * @b RemoveFromList() unlinks @p link_p directly, so unlike
+ * @c g_list_remove() it does not search the list again for the data.
+ * It takes constant time. The data is de-allocated with FreeItem().
+ *
+ * @param  myList_p pointer to the list.
+ * @param  link_p pointer to the element to remove, as returned by
+ *         FindInList().
+ * @return pointer to the new start of the list.
+ *
+ * @code
+ *  item_p = FindInList(theList_p, "Donald", SINGLESTR);
+ *  if (item_p != NULL)
+ *     theList_p = RemoveFromList(theList_p, item_p);
+ * @endcode
+ *
+ */
+GList * RemoveFromList (GList * myList_p, GList * link_p){
+    if(link_p == NULL)
+        return myList_p; // Nothing to remove
+    FreeItem(link_p->data); // The user-defined data goes first
+    return g_list_delete_link(myList_p, link_p); // Unlinks in constant time using the prev and next pointers
+}
+
+/**
+ *
+ * @brief Remove every element of a list that matches a value and
+ * de-allocate their user-defined data.
+ *
+ * @b RemoveIfInList() traverses the list only once, so removing many
+ * elements takes linear time in total. An element is removed when
+ * @p predicate returns @c EQUAL for its data, @p value_p and @p key.
+ *
+ * @param  myList_p pointer to the list.
+ * @param  predicate has the same arguments and results as
+ *         CompareItemsWithKey(), which is used if it is NULL.
+ * @param  value_p pointer to the user-defined value passed to
+ *         @p predicate.
+ * @param  key integer passed to @p predicate.
+ * @param  removed_p is where the number of removed elements is stored,
+ *         it may be NULL.
+ * @return pointer to the new start of the list.
+ *
+ * @code
+ *  nodeValue = 6;
+ *  theList_p = RemoveIfInList(theList_p, NULL, &nodeValue, SINGLEINT,
+ *                             &removed);
+ * @endcode
+ *
+ */
+GList * RemoveIfInList (GList * myList_p,
+                        int (*predicate)(const void *, const void *, int),
+                        const void *value_p, int key, int *removed_p){
+    GList *l = myList_p; // Current element
+    GList *next = NULL; // Saved before the current element is removed
+    int removed = 0;
+
+    if(predicate == NULL)
+        predicate = CompareItemsWithKey;
+    while(l != NULL)
+    { // A single pass, every match is unlinked where it is found
+        next = l->next;
+        if(predicate(l->data, value_p, key) == EQUAL){
+            myList_p = RemoveFromList(myList_p, l);
+            removed++;
+        }
+        l = next;
+    }
+    if(removed_p != NULL)
+        *removed_p = removed;
+    return myList_p;
+}
@@ -21,6 +21,10 @@
  *          Tue 10 May 2016 12:07 DST -- Added CompareItems function to
  *                          implement sort using g_list_sort()
  *          Fri 20 May 2016 22:09 DST -- Changed DoxyGen comments
+ *          Sun 18 Oct 2026 13:02 CST -- Added FindManyInList function
+ *          Sun 18 Oct 2026 13:40 CST -- Added include guard
+ *          Sun 18 Oct 2026 14:50 CST -- Added RemoveFromList and
+ *                          RemoveIfInList functions
  *
  * @warning If there is not enough memory to create a node or a list
  *          the related functions indicate failure. If the DEBUG compiler
@@ -33,6 +37,9 @@
  *
  */
 
+#ifndef USERDEFINED_H
+#define USERDEFINED_H
+
 #include <glib.h>
 #include <stdio.h>
 
@@ -326,3 +333,91 @@ GList * CopyList (GList * inputList);
  *
  */
 GList * FindInList (GList * myList_p, const void *value_p, int key);
+
+/**
+ *
+ * @brief Find many user-defined values in a list with a single traversal.
+ *
+ * @b FindManyInList() answers @p count lookups at once. The values are
+ * placed in a hash table and the list is traversed only once, stopping
+ * as soon as every value has been found. For each value the result is the
+ * same element that FindInList() would return.
+ *
+ * @param  myList_p pointer to the list to be searched.
+ * @param  values_p pointer to an array of @p count values: @c int for
+ *         @p key = SINGLEINT or @c char* for @p key = SINGLESTR.
+ * @param  count number of values in @p values_p.
+ * @param  key either SINGLEINT or SINGLESTR.
+ * @param  found_p array of @p count pointers where the element that
+ *         matches each value is stored, NULL if it was not found.
+ * @return number of values found, or -1 if the key is not supported or
+ *         there is not enough memory.
+ *
+ * @code
+ *  const char *names[] = {"Huey", "Dewey", "Louie"};
+ *  GList *found[3];
+ *  if (FindManyInList(theList_p, names, 3, SINGLESTR, found) < 3)
+ *     printf("Error: failed to find some of the nodes \n");
+ * @endcode
+ *
+ * @note   The user must check if each returned pointer is NULL
+ *         before de-referencing it.
+ *
+ */
+int FindManyInList (GList * myList_p, const void *values_p, int count,
+                    int key, GList ** found_p);
+
+/**
+ *
+ * @brief Remove an element from a list and de-allocate its user-defined
+ * data.
+ *
+ * @b RemoveFromList() unlinks @p link_p directly, so unlike
+ * @c g_list_remove() it does not search the list again for the data.
+ * It takes constant time. The data is de-allocated with FreeItem().
+ *
+ * @param  myList_p pointer to the list.
+ * @param  link_p pointer to the element to remove, as returned by
+ *         FindInList().
+ * @return pointer to the new start of the list.
+ *
+ * @code
+ *  item_p = FindInList(theList_p, "Donald", SINGLESTR);
+ *  if (item_p != NULL)
+ *     theList_p = RemoveFromList(theList_p, item_p);
+ * @endcode
+ *
+ */
+GList * RemoveFromList (GList * myList_p, GList * link_p);
+
+/**
+ *
+ * @brief Remove every element of a list that matches a value and
+ * de-allocate their user-defined data.
+ *
+ * @b RemoveIfInList() traverses the list only once, so removing many
+ * elements takes linear time in total. An element is removed when
+ * @p predicate returns @c EQUAL for its data, @p value_p and @p key.
+ *
+ * @param  myList_p pointer to the list.
+ * @param  predicate has the same arguments and results as
+ *         CompareItemsWithKey(), which is used if it is NULL.
+ * @param  value_p pointer to the user-defined value passed to
+ *         @p predicate.
+ * @param  key integer passed to @p predicate.
+ * @param  removed_p is where the number of removed elements is stored,
+ *         it may be NULL.
+ * @return pointer to the new start of the list.
+ *
+ * @code
+ *  nodeValue = 6;
+ *  theList_p = RemoveIfInList(theList_p, NULL, &nodeValue, SINGLEINT,
+ *                             &removed);
+ * @endcode
+ *
+ */
+GList * RemoveIfInList (GList * myList_p,
+                        int (*predicate)(const void *, const void *, int),
+                        const void *value_p, int key, int *removed_p);
+
+#endif
@@ -0,0 +1,1563 @@
+/**
+ * @copyright (c) 2026 Sergio Gabriel Domínguez Cordero
+ *
+ * @file    listBench.c
+ *
+ * @author  Sergio Gabriel Domínguez Cordero
+ *
+ * @brief   This program measures the list-management routines on large
+ *          randomly generated lists.
+ *
+ * @date    Sun 18 Oct 2026 16:10 CST
+ *
+ * Usage    The program runs one benchmark, or all of them if no name is
+ *          given, on a list with the requested number of records:
+ * @code
+ *   listBench [benchmark] [records]
+ * @endcode
+ *
+ * References Based on my own code for the Generic Linked lists
+ *
+ * Revision history:
+ *
+ *          Sun 18 Oct 2026 16:10 - File created, compares the generic
+ *                                  routines with the typed ones
+ *          Sun 18 Oct 2026 18:10 - Reader throughput while a writer
+ *                                  changes the list, locked and RCU
+ *          Sun 18 Oct 2026 19:05 - Parse rate of GetInt/GetString and
+ *                                  of the streaming parser
+ *          Sun 18 Oct 2026 20:10 - Memory and search time of the
+ *                                  compact list
+ *          Sun 18 Oct 2026 21:00 - Plain loops versus the prefetching
+ *                                  traversal, the copy benchmark uses
+ *                                  the whole list
+ *          Sun 18 Oct 2026 21:45 - Time the caller is blocked by the
+ *                                  destruction and the copy of a list
+ *          Sun 18 Oct 2026 22:30 - Disk-backed list with a small page
+ *                                  cache
+ *          Sun 18 Oct 2026 23:15 - Restart from the journal versus
+ *                                  parsing the node file again
+ *          Mon 19 Oct 2026 00:05 - Prefix searches, scan versus radix
+ *                                  tree
+ *          Mon 19 Oct 2026 00:50 - Aggregations, plain loop versus the
+ *                                  SIMD kernels and threads
+ *          Mon 19 Oct 2026 01:40 - Access by position and rank, GList
+ *                                  versus the order-statistic list
+ *          Mon 19 Oct 2026 02:30 - Loading sharded node files with one
+ *                                  thread and with a pool of threads
+ *          Mon 19 Oct 2026 03:15 - Churn at the ends, GList versus the
+ *                                  deque, and producer to consumer
+ *                                  pipelines with the lock-free queues
+ *          Mon 19 Oct 2026 05:20 - Hits and misses of FindInList versus
+ *                                  the Bloom filter
+ *          Mon 19 Oct 2026 05:35 - Many lookups, one FindInList each
+ *                                  versus a single FindManyInList
+ *
+ * @warning On any unrecoverable error, the program exits
+ *
+ * @note    Times are wall-clock times measured with
+ *          @c g_get_monotonic_time().
+ *
+ */
+#include <stdio.h>                                    // Used for printf
+#include <stdlib.h>                     // Used for malloc, & EXIT codes
+#include <string.h>                        // For strcmp, strlen, strcpy
+#include <unistd.h>                         // For getpid in file names
+#include <glib.h>  // Bring in glib for all doubly-linked list functions
+#include "UserDefined.h"               // All the user defined functions
+#include "TypedList.h"               // Lists specialized for one struct
+#include "SnapshotList.h"                   // Lists with lock-free readers
+#include "FileIO.h"                             // GetInt and GetString
+#include "RecordStream.h"                     // Streaming node parser
+#include "TokenScan.h"                        // Token scanning kernels
+#include "CompactList.h"                    // Compressed sorted lists
+#include "Traverse.h"                   // Prefetching list traversal
+#include "AsyncList.h"           // Background destroy and parallel copy
+#include "DiskList.h"                  // Lists kept in a file on disk
+#include "Journal.h"                // Write-ahead journal of a list
+#include "PrefixIndex.h"              // Radix tree of the strings
+#include "Aggregate.h"            // Vectorized sums, ranges, histograms
+#include "OrderStat.h"             // Positional access in O(log n)
+#include "ShardLoader.h"             // Parallel load of many node files
+#include "Deque.h"                // Ring-buffer deque, lock-free queues
+#include "BloomFilter.h"             // Filter that rejects missing keys
+
+/** @def  DEFAULT_RECORDS
+ * @brief Number of records used when none is given in the command line.
+ */
+#define DEFAULT_RECORDS 200000
+
+/** @def  LOOKUPS
+ * @brief Number of searches timed by the find benchmarks.
+ */
+#define LOOKUPS 50
+
+/** @def  BENCH_SECONDS
+ * @brief Duration of the benchmarks that run for a fixed time.
+ */
+#define BENCH_SECONDS 1.0
+
+/** @def  MAX_READERS
+ * @brief Upper limit of reader threads in the concurrent benchmarks.
+ */
+#define MAX_READERS 8
+
+/** @def  DISK_BUDGET
+ * @brief Memory budget of the disk-backed list benchmark, in bytes.
+ */
+#define DISK_BUDGET (1 << 20)
+
+/** @def  WRITER_WINDOW
+ * @brief Number of items the writer keeps inserted, it removes the oldest
+ * one and inserts a new one at the head of the list.
+ */
+#define WRITER_WINDOW 16
+
+/** @def  JOURNAL_OPS
+ * @brief Operations recorded in the journal after its snapshot, as a
+ * fraction of the records.
+ */
+#define JOURNAL_OPS 10
+
+/** @def  COMPLETIONS
+ * @brief Matches wanted by each autocompletion in the prefix benchmark.
+ */
+#define COMPLETIONS 10
+
+/** @def  HISTOGRAM_BINS
+ * @brief Bins of the histogram benchmark.
+ */
+#define HISTOGRAM_BINS 64
+
+/** @def  SHARDS
+ * @brief Number of node files written by the sharded load benchmark.
+ */
+#define SHARDS 8
+
+/** @def  DEQUE_WINDOW
+ * @brief Items kept in the queue while the deque benchmark pushes and
+ * pops at its ends.
+ */
+#define DEQUE_WINDOW 1024
+
+/** @def  PRODUCERS
+ * @brief Producer threads of the many-producer pipeline.
+ */
+#define PRODUCERS 2
+
+/** @def  MAX_MANY
+ * @brief Largest number of values looked up at once by the findmany
+ * benchmark, which starts with one and grows ten times at each step.
+ */
+#define MAX_MANY 1000
+
+DEFINE_LIST(myData, number, theString)
+
+/* Elapsed seconds since an arbitrary point in time */
+static double Now (void) {
+   return g_get_monotonic_time() / 1e6;
+}
+
+/* Build a list with random numbers and random names */
+static GList * RandomList (long records, unsigned int seed) {
+   GList * theList_p = NULL;
+   char    name[16];
+   long    i;
+   int     j, length;
+
+   srand(seed);
+   for (i = 0; i < records; i++) {
+      length = 4 + rand() % 10;
+      for (j = 0; j < length; j++)
+         name[j] = 'a' + rand() % 26;
+      name[length] = '\0';
+      theList_p = g_list_prepend(theList_p,
+                                 NewItem(rand() % (int)(4 * records), name));
+   }
+   return theList_p;
+}
+
+/* Report the time of the generic and the specialized version of a test */
+static void Report (const char *test, double generic, double typed) {
+   printf("  %-8s generic %10.6f s  typed %10.6f s  speedup %5.2fx\n",
+          test, generic, typed, typed > 0 ? generic / typed : 0.0);
+}
+
+/* Report the time of two ways of doing the same test */
+static void ReportPair (const char *test, const char *first, double a,
+                        const char *second, double b) {
+   printf("  %-8s %s %10.6f s  %s %10.6f s  speedup %5.2fx\n", test, first,
+          a, second, b, b > 0 ? a / b : 0.0);
+}
+
+/*************************************************************************
+ *       Generic (void* callbacks) versus DEFINE_LIST specialization     *
+ *************************************************************************/
+static void BenchTyped (long records) {
+   GList * theList_p = RandomList(records, 1);
+   GList * generic_p, * typed_p, * a, * b;
+   int     keys[LOOKUPS];
+   GList * found[LOOKUPS];
+   double  start, generic, typed;
+   int     i, ok = TRUE;
+
+   printf("Typed lists, %ld records\n", records);
+
+   for (i = 0; i < LOOKUPS; i++)
+      keys[i] = rand() % (int)(4 * records);
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      found[i] = FindInList(theList_p, &keys[i], SINGLEINT);
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= myDataListFindNumber(theList_p, keys[i]) == found[i];
+   typed = Now() - start;
+   Report("find", generic, typed);
+
+   generic_p = g_list_copy(theList_p);
+   typed_p = g_list_copy(theList_p);
+   start = Now();
+   generic_p = g_list_sort(generic_p, (GCompareFunc)CompareItems);
+   generic = Now() - start;
+   start = Now();
+   typed_p = myDataListSort(typed_p);
+   typed = Now() - start;
+   Report("sort", generic, typed);
+   for (a = generic_p, b = typed_p; a != NULL && b != NULL;
+        a = a->next, b = b->next)
+      ok &= a->data == b->data && (b->prev == NULL || b->prev->next == b);
+   ok &= a == NULL && b == NULL;
+   g_list_free(generic_p);
+   g_list_free(typed_p);
+
+   start = Now();
+   generic_p = CopyList(theList_p);
+   generic = Now() - start;
+   start = Now();
+   typed_p = myDataListCopy(theList_p);
+   typed = Now() - start;
+   Report("copy", generic, typed);
+   DestroyList(generic_p);
+   DestroyList(typed_p);
+   g_list_free(generic_p);
+   g_list_free(typed_p);
+
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *    Readers under write load: read-write lock versus snapshot (RCU)    *
+ *************************************************************************/
+
+/** @struct sharedList
+ * @brief The list shared by the reader threads and the writer thread.
+ */
+typedef struct sharedList_{
+   GList        * list;           // Used with the lock
+   GRWLock        lock;
+   snapshotList * snapshot;       // Used without the lock
+   long           records;
+   volatile int   stop;
+}sharedList;
+
+/** @struct worker
+ * @brief Per-thread arguments and number of operations done.
+ */
+typedef struct worker_{
+   sharedList * shared;
+   unsigned int seed;
+   long         operations;
+}worker;
+
+static gpointer LockedReader (gpointer data) {
+   worker     * worker_p = data;
+   sharedList * shared_p = worker_p->shared;
+   int          key;
+
+   while (!shared_p->stop) {
+      key = rand_r(&worker_p->seed) % (int)(4 * shared_p->records);
+      g_rw_lock_reader_lock(&shared_p->lock);
+      FindInList(shared_p->list, &key, SINGLEINT);
+      g_rw_lock_reader_unlock(&shared_p->lock);
+      worker_p->operations++;
+   }
+   return NULL;
+}
+
+static gpointer LockedWriter (gpointer data) {
+   worker     * worker_p = data;
+   sharedList * shared_p = worker_p->shared;
+   int          number = 4 * shared_p->records;     // Never a random key
+   int          oldest;
+
+   while (!shared_p->stop) {
+      oldest = number - WRITER_WINDOW;
+      g_rw_lock_writer_lock(&shared_p->lock);
+      shared_p->list = g_list_prepend(shared_p->list,
+                                      NewItem(number++, "writer"));
+      shared_p->list = RemoveFromList(shared_p->list,
+                                      FindInList(shared_p->list, &oldest,
+                                                 SINGLEINT));
+      g_rw_lock_writer_unlock(&shared_p->lock);
+      worker_p->operations++;
+   }
+   return NULL;
+}
+
+static gpointer SnapshotReader (gpointer data) {
+   worker     * worker_p = data;
+   sharedList * shared_p = worker_p->shared;
+   snapReader * reader_p = SnapRegisterReader(shared_p->snapshot);
+   int          key;
+
+   while (!shared_p->stop) {
+      key = rand_r(&worker_p->seed) % (int)(4 * shared_p->records);
+      SnapReadLock(reader_p);
+      SnapFind(reader_p, &key, SINGLEINT);
+      SnapReadUnlock(reader_p);
+      worker_p->operations++;
+   }
+   SnapUnregisterReader(reader_p);
+   return NULL;
+}
+
+static gpointer SnapshotWriter (gpointer data) {
+   worker     * worker_p = data;
+   sharedList * shared_p = worker_p->shared;
+   int          number = 4 * shared_p->records;
+   int          oldest;
+
+   while (!shared_p->stop) {
+      oldest = number - WRITER_WINDOW;
+      SnapPrepend(shared_p->snapshot, NewItem(number++, "writer"));
+      SnapRemove(shared_p->snapshot, &oldest, SINGLEINT);
+      worker_p->operations++;
+   }
+   return NULL;
+}
+
+/* Run the readers and the writer for BENCH_SECONDS, return reads/second */
+static double RunReaders (sharedList *shared_p, int readers, int writing,
+                          GThreadFunc reader, GThreadFunc writer,
+                          double *writes_p) {
+   GThread * threads[MAX_READERS + 1];
+   worker    workers[MAX_READERS + 1];
+   double    start, elapsed;
+   long      reads = 0;
+   int       i, count = readers + (writing ? 1 : 0);
+
+   shared_p->stop = FALSE;
+   for (i = 0; i < count; i++) {
+      workers[i].shared = shared_p;
+      workers[i].seed = i + 1;
+      workers[i].operations = 0;
+   }
+   start = Now();
+   for (i = 0; i < count; i++)
+      threads[i] = g_thread_new(NULL, i < readers ? reader : writer,
+                                &workers[i]);
+   g_usleep((gulong)(BENCH_SECONDS * G_USEC_PER_SEC));
+   shared_p->stop = TRUE;
+   for (i = 0; i < count; i++)
+      g_thread_join(threads[i]);
+   elapsed = Now() - start;
+
+   for (i = 0; i < readers; i++)
+      reads += workers[i].operations;
+   *writes_p = writing ? workers[readers].operations / elapsed : 0.0;
+   return reads / elapsed;
+}
+
+static void BenchSnapshot (long records) {
+   sharedList shared;
+   GList    * l;
+   double     idle, locked, snapshot, lockedWrites, snapshotWrites;
+   int        readers = g_get_num_processors() - 1;
+   int        number;
+
+   if (readers < 1)
+      readers = 1;
+   if (readers > MAX_READERS)
+      readers = MAX_READERS;
+   shared.records = records;
+   shared.list = RandomList(records, 1);
+   g_rw_lock_init(&shared.lock);
+   shared.snapshot = NewSnapshotList();
+   for (l = shared.list; l != NULL; l = l->next)
+      SnapAppend(shared.snapshot, NewItem(((node_p)l->data)->number,
+                                          ((node_p)l->data)->theString));
+   // Seed the writer window, so every write is one insert and one removal
+   for (number = 4 * records - WRITER_WINDOW; number < 4 * records;
+        number++) {
+      shared.list = g_list_prepend(shared.list, NewItem(number, "writer"));
+      SnapPrepend(shared.snapshot, NewItem(number, "writer"));
+   }
+
+   printf("Readers under write load, %ld records, %d readers, %.1f s\n",
+          records, readers, BENCH_SECONDS);
+   idle = RunReaders(&shared, readers, FALSE, LockedReader, LockedWriter,
+                     &lockedWrites);
+   locked = RunReaders(&shared, readers, TRUE, LockedReader, LockedWriter,
+                       &lockedWrites);
+   snapshot = RunReaders(&shared, readers, TRUE, SnapshotReader,
+                         SnapshotWriter, &snapshotWrites);
+   printf("  no writer     %12.0f reads/s\n", idle);
+   printf("  rwlock        %12.0f reads/s %12.0f writes/s\n",
+          locked, lockedWrites);
+   printf("  snapshot      %12.0f reads/s %12.0f writes/s\n",
+          snapshot, snapshotWrites);
+   printf("  reads kept    rwlock %5.1f%%  snapshot %5.1f%%\n",
+          idle > 0 ? 100.0 * locked / idle : 0.0,
+          idle > 0 ? 100.0 * snapshot / idle : 0.0);
+
+   SnapSynchronize(shared.snapshot);
+   DestroySnapshotList(shared.snapshot);
+   g_rw_lock_clear(&shared.lock);
+   DestroyList(shared.list);
+   g_list_free(shared.list);
+}
+
+/*************************************************************************
+ *            Parse rate: GetInt/GetString versus RecordStream           *
+ *************************************************************************/
+
+/* Write the records of a list as a node file in memory */
+static char * NodeFile (GList *theList_p, size_t *size_p) {
+   char  * text;
+   FILE  * fp = open_memstream(&text, size_p);
+   node_p  item_p;
+
+   fprintf(fp, "#\n# Generated by listBench\n#\n");
+   for (; theList_p != NULL; theList_p = theList_p->next) {
+      item_p = theList_p->data;
+      fprintf(fp, "%d %s\n", item_p->number, item_p->theString);
+   }
+   fclose(fp);
+   return text;
+}
+
+static int CountRecord (const recordView *record_p, void *sum_p) {
+   *(long *)sum_p += record_p->number;
+   return EXIT_SUCCESS;
+}
+
+/* Report a parse rate in MB/s */
+static void Rate (const char *test, size_t bytes, double seconds) {
+   printf("  %-24s %10.6f s %10.1f MB/s\n", test, seconds,
+          seconds > 0 ? bytes / seconds / 1e6 : 0.0);
+}
+
+static void BenchParse (long records) {
+   GList        * theList_p = RandomList(records, 1);
+   size_t         size;
+   char         * text = NodeFile(theList_p, &size);
+   tokenIndex   * index_p = NewTokenIndex();
+   FILE         * fp;
+   recordStream * stream_p;
+   char         * string;
+   long           sumGet = 0, sumStream = 0;
+   size_t         offset, block;
+   double         start;
+   int            number;
+
+   printf("Parsing, %ld records, %zu bytes, %s kernel\n", records, size,
+          TokenScanKernel());
+
+   fp = fmemopen(text, size, "r");
+   start = Now();
+   while (!feof(fp)) {
+      number = GetInt(fp);
+      string = GetString(fp);
+      if (string != NULL)
+         sumGet += number;
+      free(string);
+   }
+   Rate("GetInt/GetString", size, Now() - start);
+   fclose(fp);
+
+   fp = fmemopen(text, size, "r");
+   stream_p = OpenRecordStream(fp);
+   start = Now();
+   StreamRecords(stream_p, CountRecord, &sumStream);
+   Rate("RecordStream", size, Now() - start);
+   CloseRecordStream(stream_p);
+   fclose(fp);
+
+   // Upper bound: find the token boundaries without making records
+   start = Now();
+   for (offset = 0; offset < size; offset += block) {
+      block = size - offset < 65536 ? size - offset : 65536;
+      IndexTokens(index_p, text + offset, block);
+   }
+   Rate("IndexTokens only", size, Now() - start);
+   FreeTokenIndex(index_p);
+
+   printf("  results %s\n", sumGet == sumStream ? "match" : "DIFFER");
+   free(text);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *       Memory and search time: GList versus the compact list           *
+ *************************************************************************/
+static void BenchCompact (long records) {
+   GList       * theList_p = RandomList(records, 1);
+   GList       * l;
+   compactList * compact_p;
+   compactIter * iter_p;
+   recordView    record;
+   node_p        item_p;
+   int           keys[LOOKUPS];
+   GList       * found[LOOKUPS];
+   size_t        listBytes = 0;
+   long          sumList = 0, sumCompact = 0;
+   double        start, generic, compact;
+   int           i, ok = TRUE;
+
+   theList_p = g_list_sort(theList_p, (GCompareFunc)CompareItems);
+   start = Now();
+   compact_p = NewCompactList(theList_p);
+   compact = Now() - start;
+   if (compact_p == NULL) {
+      printf("No memory for the compact list\n");
+      exit (EXIT_FAILURE);
+   }
+
+   // What the list stores, not counting the allocator overhead
+   for (l = theList_p; l != NULL; l = l->next) {
+      item_p = l->data;
+      listBytes += sizeof(GList) + sizeof(myData)
+                   + strlen(item_p->theString) + 1;
+   }
+   printf("Compact list, %ld records, built in %.6f s\n", records, compact);
+   printf("  memory   list %10zu B (%5.1f B/record)  compact %10zu B "
+          "(%5.1f B/record)  ratio %5.2fx\n", listBytes,
+          (double)listBytes / records, CompactBytes(compact_p),
+          (double)CompactBytes(compact_p) / records,
+          (double)listBytes / CompactBytes(compact_p));
+
+   start = Now();
+   for (l = theList_p; l != NULL; l = l->next)
+      sumList += ((node_p)l->data)->number;
+   generic = Now() - start;
+   iter_p = NewCompactIter(compact_p);
+   start = Now();
+   while (CompactNext(iter_p, &record) == EXIT_SUCCESS)
+      sumCompact += record.number;
+   compact = Now() - start;
+   FreeCompactIter(iter_p);
+   printf("  %-8s list %10.6f s  compact %10.6f s\n", "iterate", generic,
+          compact);
+   ok &= sumList == sumCompact;
+
+   for (i = 0; i < LOOKUPS; i++)
+      keys[i] = rand() % (int)(4 * records);
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      found[i] = FindInList(theList_p, &keys[i], SINGLEINT);
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= (CompactFind(compact_p, &keys[i], SINGLEINT, &record)
+             == EXIT_SUCCESS) == (found[i] != NULL);
+   compact = Now() - start;
+   printf("  %-8s list %10.6f s  compact %10.6f s\n", "find", generic,
+          compact);
+
+   for (i = 0; i < LOOKUPS; i++)
+      found[i] = g_list_nth(theList_p, rand() % records);
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= FindInList(theList_p, ((node_p)found[i]->data)->theString,
+                       SINGLESTR) != NULL;
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= CompactFind(compact_p, ((node_p)found[i]->data)->theString,
+                        SINGLESTR, &record) == EXIT_SUCCESS;
+   compact = Now() - start;
+   printf("  %-8s list %10.6f s  compact %10.6f s\n", "findstr", generic,
+          compact);
+
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   FreeCompactList(compact_p);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *           Plain loops versus the prefetching traversal                *
+ *************************************************************************/
+
+/* Touches the data and the string of every element */
+static void AddItem (void *sum_p, node_p item_p) {
+   *(long *)sum_p += item_p->number + item_p->theString[0];
+}
+
+/* Time a plain loop and the traversal functions on one list */
+static int TimeTraverse (const char *layout, GList *theList_p) {
+   GList * l;
+   long    sumLoop = 0, sumReduce = 0;
+   double  start, loop, prefetch;
+   int     missing = -1, ok = TRUE;
+
+   printf("  %s\n", layout);
+   start = Now();
+   for (l = theList_p; l != NULL; l = l->next)
+      AddItem(&sumLoop, l->data);
+   loop = Now() - start;
+   start = Now();
+   ListReduce(theList_p, AddItem, &sumReduce);
+   prefetch = Now() - start;
+   printf("    %-8s loop %10.6f s  prefetch %10.6f s  speedup %5.2fx\n",
+          "reduce", loop, prefetch, prefetch > 0 ? loop / prefetch : 0.0);
+   ok &= sumLoop == sumReduce;
+
+   start = Now();
+   for (l = theList_p; l != NULL; l = l->next)   // What FindInList did
+      if (CompareItemsWithKey(l->data, "0", SINGLESTR) == EQUAL)
+         break;
+   loop = Now() - start;
+   ok &= l == NULL;
+   start = Now();
+   ok &= FindInList(theList_p, "0", SINGLESTR) == NULL;
+   prefetch = Now() - start;
+   printf("    %-8s loop %10.6f s  prefetch %10.6f s  speedup %5.2fx\n",
+          "find", loop, prefetch, prefetch > 0 ? loop / prefetch : 0.0);
+   ok &= FindInList(theList_p, &missing, SINGLEINT) == NULL;
+   return ok;
+}
+
+static void BenchTraverse (long records) {
+   GList * theList_p = RandomList(records, 1);
+   GList * copy_p;
+   int     ok = TRUE;
+
+   printf("Traversal, %ld records, about %zu MB, prefetch distance %d\n",
+          records, records * (sizeof(GList) + sizeof(myData) + 16) >> 20,
+          TRAVERSE_AHEAD);
+
+   // Sorting relinks the list, so the data is no longer in memory order.
+   // A shallow copy has new links in memory order with the same data.
+   theList_p = g_list_sort(theList_p, (GCompareFunc)CompareItems);
+   copy_p = g_list_copy(theList_p);
+   ok &= TimeTraverse("links in order, data scattered", copy_p);
+   ok &= TimeTraverse("links and data scattered", theList_p);
+
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   g_list_free(copy_p);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *     Caller blocking time: destroy in the background, parallel copy    *
+ *************************************************************************/
+static void BenchAsync (long records) {
+   GList * theList_p = RandomList(records, 1);
+   GList * copy_p, * a, * b;
+   double  start, blocked, total;
+   int     threads, ok = TRUE;
+
+   printf("Background destroy and parallel copy, %ld records, %u CPUs\n",
+          records, g_get_num_processors());
+
+   start = Now();
+   copy_p = CopyList(theList_p);
+   printf("  %-22s blocked %10.6f s\n", "CopyList", Now() - start);
+   start = Now();
+   DestroyList(copy_p);
+   g_list_free(copy_p);
+   printf("  %-22s blocked %10.6f s\n", "DestroyList", Now() - start);
+
+   copy_p = CopyList(theList_p);
+   start = Now();
+   DestroyListAsync(copy_p);
+   blocked = Now() - start;
+   WaitReclaimer();
+   total = Now() - start;
+   printf("  %-22s blocked %10.6f s  done after %10.6f s\n",
+          "DestroyListAsync", blocked, total);
+
+   for (threads = 1; threads <= MAX_READERS; threads *= 2) {
+      start = Now();
+      copy_p = CopyListParallel(theList_p, threads);
+      blocked = Now() - start;
+      printf("  CopyListParallel %2d     blocked %10.6f s\n", threads,
+             blocked);
+      for (a = theList_p, b = copy_p; a != NULL && b != NULL;
+           a = a->next, b = b->next)
+         ok &= ((node_p)a->data)->number == ((node_p)b->data)->number;
+      ok &= a == NULL && b == NULL;
+      DestroyListAsync(copy_p);
+   }
+
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   DestroyListAsync(theList_p);
+   StopReclaimer();
+}
+
+/*************************************************************************
+ *             Disk-backed list with a small page cache                  *
+ *************************************************************************/
+static int SumRecord (const recordView *record_p, void *sum_p) {
+   *(long *)sum_p += record_p->number;
+   return EXIT_SUCCESS;
+}
+
+/* Compare the records with a sorted list, one at a time */
+static int CheckOrder (const recordView *record_p, void *list_pp) {
+   node_p item_p = (*(GList **)list_pp)->data;
+
+   *(GList **)list_pp = (*(GList **)list_pp)->next;
+   if (item_p->number != record_p->number ||
+       strcmp(item_p->theString, record_p->theString) != 0)
+      return EXIT_FAILURE;
+   return EXIT_SUCCESS;
+}
+
+static void BenchDisk (long records) {
+   GList      * theList_p = RandomList(records, 1);
+   GList      * l;
+   diskList   * disk_p = NewDiskList(NULL, DISK_BUDGET);
+   diskStats    stats;
+   recordView   record;
+   node_p       item_p;
+   long         sumList = 0, sumDisk = 0;
+   double       start;
+   int          i, ok = TRUE;
+
+   if (disk_p == NULL) {
+      printf("Could not create the disk-backed list\n");
+      exit (EXIT_FAILURE);
+   }
+   printf("Disk-backed list, %ld records, %d KiB of memory\n", records,
+          DISK_BUDGET >> 10);
+
+   start = Now();
+   for (l = theList_p; l != NULL; l = l->next) {
+      item_p = l->data;
+      ok &= DiskAppend(disk_p, item_p->number, item_p->theString)
+            == EXIT_SUCCESS;
+   }
+   ok &= FlushDiskList(disk_p) == EXIT_SUCCESS;
+   printf("  %-8s %10.6f s\n", "append", Now() - start);
+
+   start = Now();
+   DiskRecords(disk_p, SumRecord, &sumDisk);
+   printf("  %-8s %10.6f s\n", "scan", Now() - start);
+   for (l = theList_p; l != NULL; l = l->next)
+      sumList += ((node_p)l->data)->number;
+   ok &= sumList == sumDisk;
+
+   start = Now();
+   for (i = 0; i < LOOKUPS / 10; i++) {
+      item_p = g_list_nth_data(theList_p, rand() % records);
+      ok &= DiskFind(disk_p, item_p->theString, SINGLESTR, &record) >= 0;
+   }
+   printf("  %-8s %10.6f s for %d lookups\n", "find", Now() - start,
+          LOOKUPS / 10);
+
+   start = Now();
+   ok &= SortDiskList(disk_p) == EXIT_SUCCESS;
+   printf("  %-8s %10.6f s\n", "sort", Now() - start);
+   theList_p = g_list_sort(theList_p, (GCompareFunc)CompareItems);
+   l = theList_p;
+   ok &= DiskRecords(disk_p, CheckOrder, &l) == records;
+
+   DiskListStats(disk_p, &stats);
+   printf("  pages %ld, in memory %ld, hits %lu, misses %lu, "
+          "reads %lu, writes %lu\n", stats.pages, stats.frames, stats.hits,
+          stats.misses, stats.reads, stats.writes);
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   CloseDiskList(disk_p);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *       Restart: snapshot and journal replay versus text parsing        *
+ *************************************************************************/
+
+/* Compare two lists record by record */
+static int SameList (GList *a, GList *b) {
+   node_p x, y;
+
+   for (; a != NULL && b != NULL; a = a->next, b = b->next) {
+      x = a->data;
+      y = b->data;
+      if (x->number != y->number || strcmp(x->theString, y->theString) != 0)
+         return FALSE;
+   }
+   return a == NULL && b == NULL;
+}
+
+static void BenchJournal (long records) {
+   GList   * theList_p = RandomList(records, 1);
+   GList   * loaded_p = NULL, * recovered_p;
+   journal * journal_p;
+   size_t    size;
+   char    * text, * string, path[64], file[72], name[8];
+   FILE    * fp;
+   double    start, parse, recover;
+   long      i, n, ops = records / JOURNAL_OPS;
+   int       j, number, ok = TRUE;
+
+   snprintf(path, sizeof(path), "%s/listBench.%d", P_tmpdir, (int)getpid());
+   journal_p = OpenJournal(path, 0, &recovered_p);
+   if (journal_p == NULL) {
+      printf("Could not open the journal %s\n", path);
+      exit (EXIT_FAILURE);
+   }
+   printf("Journal, %ld records, %ld operations after the snapshot\n",
+          records, ops);
+
+   start = Now();
+   ok &= CompactJournal(journal_p, theList_p) == EXIT_SUCCESS;
+   printf("  %-10s %10.6f s\n", "snapshot", Now() - start);
+
+   // Half the operations insert at the head, half remove the second item.
+   // Names are only letters, as GetString() expects.
+   start = Now();
+   for (i = 0; i < ops; i++) {
+      if (i % 2 == 0) {
+         for (j = 0, n = i; j < 6; j++, n /= 26)
+            name[j] = 'a' + n % 26;
+         name[j] = '\0';
+         theList_p = JournalPrepend(journal_p, theList_p, (int)i, name);
+      } else {
+         theList_p = JournalRemove(journal_p, theList_p, theList_p->next);
+      }
+   }
+   ok &= CloseJournal(journal_p) == EXIT_SUCCESS;
+   printf("  %-10s %10.6f s with group commit\n", "log", Now() - start);
+
+   // What a restart without the journal does: parse the node file
+   text = NodeFile(theList_p, &size);
+   fp = fmemopen(text, size, "r");
+   start = Now();
+   while (!feof(fp)) {
+      number = GetInt(fp);
+      string = GetString(fp);
+      if (string != NULL)
+         loaded_p = g_list_prepend(loaded_p, NewItem(number, string));
+      free(string);
+   }
+   loaded_p = g_list_reverse(loaded_p);
+   parse = Now() - start;
+   fclose(fp);
+   free(text);
+
+   start = Now();
+   journal_p = OpenJournal(path, 0, &recovered_p);
+   recover = Now() - start;
+   ok &= journal_p != NULL && JournalReplayed(journal_p) == ops;
+   printf("  %-10s %10.6f s\n", "parse", parse);
+   printf("  %-10s %10.6f s  speedup %5.2fx\n", "recover", recover,
+          recover > 0 ? parse / recover : 0.0);
+
+   ok &= SameList(theList_p, loaded_p) && SameList(theList_p, recovered_p);
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   CloseJournal(journal_p);
+   snprintf(file, sizeof(file), "%s.snap", path);
+   remove(file);
+   snprintf(file, sizeof(file), "%s.log", path);
+   remove(file);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+   DestroyList(loaded_p);
+   g_list_free(loaded_p);
+   DestroyList(recovered_p);
+   g_list_free(recovered_p);
+}
+
+/*************************************************************************
+ *            Prefix searches: list scan versus radix tree               *
+ *************************************************************************/
+static int CountLink (GList *link_p, void *count_p) {
+   return ++*(long *)count_p < COMPLETIONS ? EXIT_SUCCESS : EXIT_FAILURE;
+}
+
+static int SumLink (GList *link_p, void *sum_p) {
+   *(long *)sum_p += ((node_p)link_p->data)->number;
+   return EXIT_SUCCESS;
+}
+
+static void BenchPrefix (long records) {
+   GList      * theList_p = RandomList(records, 1);
+   GList      * l;
+   prefixList * prefix_p;
+   char         prefixes[LOOKUPS][4];
+   long         sumScan = 0, sumTree = 0, found = 0, count;
+   size_t       length;
+   double       start, scan, tree;
+   int          i, ok = TRUE;
+
+   start = Now();
+   prefix_p = NewPrefixList(theList_p);
+   if (prefix_p == NULL) {
+      printf("Could not build the radix tree\n");
+      exit (EXIT_FAILURE);
+   }
+   printf("Prefix searches, %ld records, tree built in %.6f s, %ld nodes, "
+          "%zu bytes\n", records, Now() - start, prefix_p->nodes,
+          PrefixBytes(prefix_p));
+
+   for (i = 0; i < LOOKUPS; i++) {
+      length = 1 + i % 3;
+      prefixes[i][0] = 'a' + rand() % 26;
+      prefixes[i][1] = 'a' + rand() % 26;
+      prefixes[i][2] = 'a' + rand() % 26;
+      prefixes[i][length] = '\0';
+   }
+
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++) {
+      length = strlen(prefixes[i]);
+      for (l = theList_p; l != NULL; l = l->next)
+         if (strncmp(((node_p)l->data)->theString, prefixes[i], length) == 0)
+            sumScan += ((node_p)l->data)->number;
+   }
+   scan = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      found += PrefixMatches(prefix_p, prefixes[i], SumLink, &sumTree);
+   tree = Now() - start;
+   ReportPair("prefix", "scan", scan, "tree", tree);
+   printf("  %ld matches\n", found);
+   ok &= sumScan == sumTree;
+
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++) {
+      count = 0;
+      PrefixMatches(prefix_p, prefixes[i], CountLink, &count);
+      ok &= count == MIN(PrefixCount(prefix_p, prefixes[i]), COMPLETIONS);
+   }
+   printf("  %-8s %10.6f s for %d autocompletions of %d names\n",
+          "complete", Now() - start, LOOKUPS, COMPLETIONS);
+
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   theList_p = FreePrefixList(prefix_p);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *      Aggregations: plain loop versus SIMD kernels and threads         *
+ *************************************************************************/
+
+/* Report the time and the rate over the records of the list in GB/s */
+static void Throughput (const char *test, long records, double seconds) {
+   double bytes = (double)records * (sizeof(GList) + sizeof(myData));
+
+   printf("  %-24s %10.6f s %8.2f GB/s\n", test, seconds,
+          seconds > 0 ? bytes / seconds / 1e9 : 0.0);
+}
+
+static int SameResult (const aggregate *a_p, const aggregate *b_p) {
+   return a_p->count == b_p->count && a_p->sum == b_p->sum &&
+          a_p->min == b_p->min && a_p->max == b_p->max &&
+          a_p->inRange == b_p->inRange;
+}
+
+static void BenchAggregate (long records) {
+   GList        * theList_p = RandomList(records, 1);
+   GList        * l;
+   numberColumn * column_p;
+   aggregate      reference = {0, 0, G_MAXINT, G_MININT, 0}, result;
+   long           bins[HISTOGRAM_BINS], check[HISTOGRAM_BINS] = {0};
+   int            low = records, high = 2 * records, width, number;
+   int            threads, b, ok = TRUE;
+   double         start;
+   char           test[32];
+
+   printf("Aggregation, %ld records, %s kernel, %u CPUs\n", records,
+          AggregateKernel(), g_get_num_processors());
+
+   // The reference: the loop written by hand over the list
+   width = (4 * records + HISTOGRAM_BINS - 1) / HISTOGRAM_BINS;
+   start = Now();
+   for (l = theList_p; l != NULL; l = l->next) {
+      number = ((node_p)l->data)->number;
+      reference.count++;
+      reference.sum += number;
+      if (number < reference.min)
+         reference.min = number;
+      if (number > reference.max)
+         reference.max = number;
+      if (number >= low && number <= high)
+         reference.inRange++;
+   }
+   Throughput("plain loop", records, Now() - start);
+   for (l = theList_p; l != NULL; l = l->next)
+      check[((node_p)l->data)->number / width]++;
+
+   start = Now();
+   AggregateList(theList_p, low, high, &result);
+   Throughput("AggregateList", records, Now() - start);
+   ok &= SameResult(&reference, &result);
+
+   start = Now();
+   column_p = NewNumberColumn(theList_p);
+   if (column_p == NULL) {
+      printf("Could not build the column\n");
+      exit (EXIT_FAILURE);
+   }
+   Throughput("NewNumberColumn", records, Now() - start);
+
+   for (threads = 1; threads <= MAX_READERS; threads *= 2) {
+      start = Now();
+      AggregateColumn(column_p, low, high, threads, &result);
+      snprintf(test, sizeof(test), "AggregateColumn %d", threads);
+      Throughput(test, records, Now() - start);
+      ok &= SameResult(&reference, &result);
+   }
+   for (threads = 1; threads <= MAX_READERS; threads *= MAX_READERS) {
+      start = Now();
+      ok &= HistogramColumn(column_p, 0, width, HISTOGRAM_BINS, bins,
+                            threads) == records;
+      snprintf(test, sizeof(test), "HistogramColumn %d", threads);
+      Throughput(test, records, Now() - start);
+      for (b = 0; b < HISTOGRAM_BINS; b++)
+         ok &= bins[b] == check[b];
+   }
+
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   FreeNumberColumn(column_p);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *     Positional access: GList walks versus the order-statistic tree    *
+ *************************************************************************/
+static void BenchOrder (long records) {
+   GList     * theList_p = RandomList(records, 1);
+   GList     * l;
+   orderList * order_p;
+   orderLink * link_p;
+   node_p      items[LOOKUPS];
+   long        positions[LOOKUPS], length = records;
+   double      start, generic, typed;
+   int         i, ok = TRUE;
+
+   theList_p = g_list_sort(theList_p, (GCompareFunc)CompareItems);
+   start = Now();
+   order_p = NewOrderList(theList_p);
+   if (order_p == NULL) {
+      printf("Could not build the order-statistic list\n");
+      exit (EXIT_FAILURE);
+   }
+   printf("Order statistics, %ld records, built in %.6f s\n", records,
+          Now() - start);
+
+   for (i = 0; i < LOOKUPS; i++)
+      positions[i] = rand() % records;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      l = g_list_nth(theList_p, positions[i]);
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      link_p = OrderNth(order_p, positions[i]);
+   typed = Now() - start;
+   ReportPair("nth", "GList", generic, "tree", typed);
+   ok &= l->data == link_p->data;
+
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= g_list_position(theList_p, g_list_nth(theList_p, positions[i]))
+            == positions[i];
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= OrderRank(OrderNth(order_p, positions[i])) == positions[i];
+   typed = Now() - start;
+   ReportPair("rank", "GList", generic, "tree", typed);
+
+   // The same items go in both, at the same positions
+   for (i = 0; i < LOOKUPS; i++)
+      items[i] = NewItem(i, "Inserted");
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      theList_p = g_list_insert(theList_p, items[i], positions[i]);
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= OrderInsertAt(order_p, positions[i], items[i]) != NULL;
+   typed = Now() - start;
+   ReportPair("insert", "GList", generic, "tree", typed);
+   length += LOOKUPS;
+
+   // Removing from the tree frees the item, so take it out of the list
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++) {
+      l = g_list_nth(theList_p, positions[i]);
+      theList_p = g_list_delete_link(theList_p, l);
+   }
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      OrderRemoveAt(order_p, positions[i]);
+   typed = Now() - start;
+   ReportPair("remove", "GList", generic, "tree", typed);
+   length -= LOOKUPS;
+
+   ok &= OrderLength(order_p) == length;
+   for (l = theList_p, link_p = OrderFirst(order_p); l != NULL &&
+        link_p != NULL; l = l->next, link_p = OrderNext(link_p))
+      ok &= l->data == link_p->data;
+   ok &= l == NULL && link_p == NULL;
+
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   DestroyOrderList(order_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *        Sharded load: one thread versus a pool, concat and merge       *
+ *************************************************************************/
+
+/* Compare a loaded list with the shards one after another */
+static int SameShards (GList *theList_p, GList **shards) {
+   GList * l = theList_p, * s;
+   node_p  x, y;
+   int     i;
+
+   for (i = 0; i < SHARDS; i++)
+      for (s = shards[i]; s != NULL; s = s->next, l = l->next) {
+         if (l == NULL)
+            return FALSE;
+         x = l->data;
+         y = s->data;
+         if (x->number != y->number ||
+             strcmp(x->theString, y->theString) != 0)
+            return FALSE;
+      }
+   return l == NULL;
+}
+
+static void BenchShards (long records) {
+   static const char * joins[] = {"concat", "merge"};
+   GList      * theList_p = RandomList(records, 1);
+   GList      * shards[SHARDS] = {NULL}, * loaded_p, * l;
+   const char * files[SHARDS];
+   char         names[SHARDS][64], * text;
+   loadTimes    total;
+   size_t       size, bytes = 0;
+   FILE       * fp;
+   long         k = 0, count;
+   int          i, join, threads, ok = TRUE;
+
+   // Deal the sorted list to the shards, so every shard is sorted
+   theList_p = g_list_sort(theList_p, (GCompareFunc)CompareItems);
+   for (l = theList_p; l != NULL; l = l->next, k++)
+      shards[k % SHARDS] = g_list_prepend(shards[k % SHARDS], l->data);
+   for (i = 0; i < SHARDS; i++) {
+      shards[i] = g_list_reverse(shards[i]);
+      snprintf(names[i], sizeof(names[i]), "%s/listBench.%d.%d", P_tmpdir,
+               (int)getpid(), i);
+      files[i] = names[i];
+      text = NodeFile(shards[i], &size);
+      fp = fopen(names[i], "w");
+      if (fp == NULL || fwrite(text, 1, size, fp) != size) {
+         printf("Could not write the shard %s\n", names[i]);
+         exit (EXIT_FAILURE);
+      }
+      fclose(fp);
+      free(text);
+      bytes += size;
+   }
+   printf("Sharded load, %ld records in %d files, %zu bytes, %u CPUs\n",
+          records, SHARDS, bytes, g_get_num_processors());
+
+   for (join = SHARD_CONCAT; join <= SHARD_MERGE; join++)
+      for (threads = 1; threads <= MAX_READERS; threads *= MAX_READERS) {
+         loaded_p = LoadShards(files, SHARDS, threads, join, NULL, &total);
+         printf("  %-6s %2d threads %10.6f s %8.1f MB/s  serial %10.6f s\n",
+                joins[join], threads, total.wall,
+                total.wall > 0 ? total.bytes / total.wall / 1e6 : 0.0,
+                total.read + total.parse);
+         ok &= loaded_p != NULL && total.records == records;
+         if (join == SHARD_CONCAT) {
+            ok &= SameShards(loaded_p, shards);
+         } else {
+            for (l = loaded_p, count = 0; l != NULL; l = l->next, count++)
+               ok &= l->next == NULL ||
+                     CompareItems(l->data, l->next->data) != GREATER;
+            ok &= count == records;
+         }
+         DestroyList(loaded_p);
+         g_list_free(loaded_p);
+      }
+
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   for (i = 0; i < SHARDS; i++) {
+      remove(names[i]);
+      g_list_free(shards[i]);
+   }
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *   Churn at the ends: GList versus deque, pipelines between threads    *
+ *************************************************************************/
+
+/* Compare a list with a deque item by item */
+static int SameDeque (GList *theList_p, const nodeDeque *deque_p) {
+   size_t i;
+
+   for (i = 0; theList_p != NULL; theList_p = theList_p->next, i++)
+      if (theList_p->data != DequeNth(deque_p, i))
+         return FALSE;
+   return i == DequeLength(deque_p);
+}
+
+/** @struct pipeline
+ * @brief Queues shared by the producers and the items one of them pushes.
+ */
+typedef struct pipeline_{
+   GAsyncQueue * async;
+   spscQueue   * spsc;
+   mpscQueue   * mpsc;
+   node_p      * items;
+   long          first;                 // First item of this producer
+   long          count;                 // Items it pushes
+}pipeline;
+
+static gpointer AsyncProducer (gpointer data) {
+   pipeline * pipe_p = data;
+   long       i;
+
+   for (i = pipe_p->first; i < pipe_p->first + pipe_p->count; i++)
+      g_async_queue_push(pipe_p->async, pipe_p->items[i]);
+   return NULL;
+}
+
+static gpointer SpscProducer (gpointer data) {
+   pipeline * pipe_p = data;
+   long       i;
+
+   for (i = pipe_p->first; i < pipe_p->first + pipe_p->count; i++)
+      while (SpscPush(pipe_p->spsc, pipe_p->items[i]) != EXIT_SUCCESS)
+         g_thread_yield();
+   return NULL;
+}
+
+static gpointer MpscProducer (gpointer data) {
+   pipeline * pipe_p = data;
+   long       i;
+
+   for (i = pipe_p->first; i < pipe_p->first + pipe_p->count; i++)
+      while (MpscPush(pipe_p->mpsc, pipe_p->items[i]) != EXIT_SUCCESS)
+         g_thread_yield();
+   return NULL;
+}
+
+static node_p AsyncTake (pipeline *pipe_p) {
+   return g_async_queue_pop(pipe_p->async);
+}
+
+static node_p SpscTake (pipeline *pipe_p) {
+   node_p item_p;
+
+   while ((item_p = SpscPop(pipe_p->spsc)) == NULL)
+      g_thread_yield();
+   return item_p;
+}
+
+static node_p MpscTake (pipeline *pipe_p) {
+   node_p item_p;
+
+   while ((item_p = MpscPop(pipe_p->mpsc)) == NULL)
+      g_thread_yield();
+   return item_p;
+}
+
+/* Start the producers and take every item here, return the seconds */
+static double RunPipeline (pipeline *pipes, int producers,
+                           GThreadFunc produce, node_p (*take)(pipeline *),
+                           long records, long *sum_p) {
+   GThread * threads[PRODUCERS];
+   double    start = Now();
+   long      i;
+   int       p;
+
+   for (p = 0; p < producers; p++)
+      threads[p] = g_thread_new(NULL, produce, &pipes[p]);
+   for (*sum_p = 0, i = 0; i < records; i++)
+      *sum_p += take(&pipes[0])->number;
+   for (p = 0; p < producers; p++)
+      g_thread_join(threads[p]);
+   return Now() - start;
+}
+
+static void BenchDeque (long records) {
+   GList     * theList_p = RandomList(records, 1);
+   GList     * window_p = NULL, * l;
+   nodeDeque * deque_p = NewDeque(DEQUE_WINDOW);
+   node_p    * items = malloc(records * sizeof(node_p));
+   pipeline    pipes[PRODUCERS];
+   double      start, generic, typed;
+   long        i, sum = 0, got;
+   int         p, ok = TRUE;
+
+   if (deque_p == NULL || items == NULL) {
+      printf("Could not allocate the deque\n");
+      exit (EXIT_FAILURE);
+   }
+   for (i = 0, l = theList_p; l != NULL; l = l->next, i++) {
+      items[i] = l->data;
+      sum += items[i]->number;
+   }
+   for (i = 0; i < DEQUE_WINDOW; i++) {
+      window_p = g_list_append(window_p, items[i % records]);
+      DequePushBack(deque_p, items[i % records]);
+   }
+   printf("Churn at the ends, %ld operations, %d items queued\n", records,
+          DEQUE_WINDOW);
+
+   // Queue: in at the tail, out at the head
+   start = Now();
+   for (i = 0; i < records; i++) {
+      window_p = g_list_append(window_p, items[i]);
+      window_p = g_list_delete_link(window_p, window_p);
+   }
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < records; i++) {
+      DequePushBack(deque_p, items[i]);
+      DequePopFront(deque_p);
+   }
+   typed = Now() - start;
+   ReportPair("fifo", "GList", generic, "deque", typed);
+   ok &= SameDeque(window_p, deque_p);
+
+   // Stack at the tail, as the tail tests of listTest
+   start = Now();
+   for (i = 0; i < records; i++) {
+      window_p = g_list_append(window_p, items[i]);
+      window_p = g_list_delete_link(window_p, g_list_last(window_p));
+   }
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < records; i++) {
+      DequePushBack(deque_p, items[i]);
+      DequePopBack(deque_p);
+   }
+   typed = Now() - start;
+   ReportPair("tail", "GList", generic, "deque", typed);
+   ok &= SameDeque(window_p, deque_p);
+
+   // Stack at the head, where GList only pays for the links
+   start = Now();
+   for (i = 0; i < records; i++) {
+      window_p = g_list_prepend(window_p, items[i]);
+      window_p = g_list_delete_link(window_p, window_p);
+   }
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < records; i++) {
+      DequePushFront(deque_p, items[i]);
+      DequePopFront(deque_p);
+   }
+   typed = Now() - start;
+   ReportPair("head", "GList", generic, "deque", typed);
+   ok &= SameDeque(window_p, deque_p);
+
+   printf("Pipelines, %ld items, %u CPUs\n", records,
+          g_get_num_processors());
+   pipes[0].async = g_async_queue_new();
+   pipes[0].spsc = NewSpscQueue(DEQUE_WINDOW);
+   pipes[0].mpsc = NewMpscQueue(DEQUE_WINDOW);
+   pipes[0].items = items;
+   if (pipes[0].spsc == NULL || pipes[0].mpsc == NULL) {
+      printf("Could not allocate the queues\n");
+      exit (EXIT_FAILURE);
+   }
+
+   // One producer pushes every item
+   pipes[0].first = 0;
+   pipes[0].count = records;
+   generic = RunPipeline(pipes, 1, AsyncProducer, AsyncTake, records, &got);
+   ok &= got == sum;
+   typed = RunPipeline(pipes, 1, SpscProducer, SpscTake, records, &got);
+   ok &= got == sum;
+   ReportPair("1 to 1", "GAsyncQueue", generic, "spsc", typed);
+
+   // The items are split among the producers
+   for (p = 0; p < PRODUCERS; p++) {
+      pipes[p] = pipes[0];
+      pipes[p].first = records / PRODUCERS * p;
+      pipes[p].count = p < PRODUCERS - 1 ? records / PRODUCERS :
+                       records - pipes[p].first;
+   }
+   generic = RunPipeline(pipes, PRODUCERS, AsyncProducer, AsyncTake,
+                         records, &got);
+   ok &= got == sum;
+   typed = RunPipeline(pipes, PRODUCERS, MpscProducer, MpscTake, records,
+                       &got);
+   ok &= got == sum;
+   ReportPair("n to 1", "GAsyncQueue", generic, "mpsc", typed);
+
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   g_async_queue_unref(pipes[0].async);
+   FreeSpscQueue(pipes[0].spsc);
+   FreeMpscQueue(pipes[0].mpsc);
+   FreeDeque(deque_p);
+   free(items);
+   g_list_free(window_p);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *          Searches for hits and misses: scan versus Bloom filter       *
+ *************************************************************************/
+static void BenchBloom (long records) {
+   GList     * theList_p = RandomList(records, 1);
+   GList     * found[LOOKUPS];
+   bloomList * bloom_p;
+   int         hits[LOOKUPS], misses[LOOKUPS];
+   double      start, generic, typed;
+   int         i, ok = TRUE;
+
+   bloom_p = NewBloomList(theList_p, 0, 0.01);
+   if (bloom_p == NULL) {
+      printf("Could not build the Bloom filter\n");
+      exit (EXIT_FAILURE);
+   }
+   printf("Bloom filter, %ld records, %d hits and %d misses\n", records,
+          LOOKUPS, LOOKUPS);
+
+   // RandomList() numbers are below 4 * records, so these are all misses
+   for (i = 0; i < LOOKUPS; i++) {
+      hits[i] = ((node_p)g_list_nth_data(theList_p, rand() % records))
+                ->number;
+      misses[i] = 4 * records + rand() % (int)records;
+   }
+
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      found[i] = FindInList(theList_p, &hits[i], SINGLEINT);
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= BloomFind(bloom_p, &hits[i], SINGLEINT) == found[i] &&
+            found[i] != NULL;
+   typed = Now() - start;
+   ReportPair("hits", "scan", generic, "bloom", typed);
+
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= FindInList(theList_p, &misses[i], SINGLEINT) == NULL;
+   generic = Now() - start;
+   start = Now();
+   for (i = 0; i < LOOKUPS; i++)
+      ok &= BloomFind(bloom_p, &misses[i], SINGLEINT) == NULL;
+   typed = Now() - start;
+   ReportPair("misses", "scan", generic, "bloom", typed);
+
+   PrintBloomStats(bloom_p, stdout);
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   theList_p = FreeBloomList(bloom_p);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/*************************************************************************
+ *       Many lookups: one FindInList each versus FindManyInList         *
+ *************************************************************************/
+static void BenchFindMany (long records) {
+   GList * theList_p = RandomList(records, 1);
+   GList * single[MAX_MANY], * many[MAX_MANY];
+   int     keys[MAX_MANY];
+   char    label[16];
+   double  start, generic, typed;
+   int     i, k, found, ok = TRUE;
+
+   printf("Many lookups, %ld records, about half of them misses\n",
+          records);
+
+   // RandomList() numbers are below 4 * records, so half of these miss
+   for (i = 0; i < MAX_MANY; i++)
+      keys[i] = rand() % (int)(8 * records);
+   for (k = 1; k <= MAX_MANY; k *= 10) {
+      start = Now();
+      for (i = 0; i < k; i++)
+         single[i] = FindInList(theList_p, &keys[i], SINGLEINT);
+      generic = Now() - start;
+      start = Now();
+      found = FindManyInList(theList_p, keys, k, SINGLEINT, many);
+      typed = Now() - start;
+      for (i = 0; i < k; i++) {
+         ok &= many[i] == single[i];
+         found -= many[i] != NULL;
+      }
+      ok &= found == 0;
+      snprintf(label, sizeof(label), "k=%d", k);
+      ReportPair(label, "single", generic, "many", typed);
+   }
+   printf("  results %s\n", ok ? "match" : "DIFFER");
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+}
+
+/** @struct benchmark
+ * @brief Name and entry point of each benchmark.
+ */
+typedef struct benchmark_{
+   const char * name;
+   void      (* run)(long records);
+}benchmark;
+
+static const benchmark benchmarks[] = {
+   {"typed", BenchTyped},
+   {"snapshot", BenchSnapshot},
+   {"parse", BenchParse},
+   {"compact", BenchCompact},
+   {"traverse", BenchTraverse},
+   {"async", BenchAsync},
+   {"disk", BenchDisk},
+   {"journal", BenchJournal},
+   {"prefix", BenchPrefix},
+   {"aggregate", BenchAggregate},
+   {"order", BenchOrder},
+   {"shards", BenchShards},
+   {"deque", BenchDeque},
+   {"bloom", BenchBloom},
+   {"findmany", BenchFindMany},
+};
+
+/*************************************************************************
+ *                           Main entry point                            *
+ *************************************************************************/
+int main (int argc, const char * argv[]) {          // Program entry point
+   long   records = DEFAULT_RECORDS;
+   size_t i;
+   int    ran = FALSE;
+
+   if (argc > 2)
+      records = atol(argv[2]);
+   if (records <= 0) {
+      printf("The number of records must be positive\n");
+      exit (EXIT_FAILURE);
+   }
+
+   for (i = 0; i < sizeof(benchmarks) / sizeof(benchmarks[0]); i++)
+      if (argc < 2 || strcmp(argv[1], benchmarks[i].name) == 0) {
+         benchmarks[i].run(records);
+         ran = TRUE;
+      }
+
+   if (!ran) {
+      printf("Unknown benchmark: %s\n", argv[1]);
+      exit (EXIT_FAILURE);
+   }
+   return (EXIT_SUCCESS);
+}
@@ -12,7 +12,7 @@
  * Usage    The program reads a text file with the elements that will
  *          be converted into nodes in a linked list. The usage form is:
  * @code
- *   listTest file.txt
+ *   listTest file.txt [shard.txt ...]
  * @endcode
  *
  * References Based on my own code for the Generic Linked lists
@@ -37,6 +37,28 @@
  *          Fri 06 Feb 2015 14:33 - Added doxygen documentation commands
  *          Thu 26 Feb 2015 12:08 - Added final tests for the library
  *          Thu 05 May 2016 10:52 - Changed code to use Glib for lists
+ *          Sun 18 Oct 2026 10:12 - Dump the operation counters when
+ *                                  compiled with -DSTATS
+ *          Sun 18 Oct 2026 11:05 - Added tests for the streaming parser
+ *          Sun 18 Oct 2026 12:20 - Added test for the read-ahead loader
+ *          Sun 18 Oct 2026 13:40 - Added test for the top-k selection
+ *          Sun 18 Oct 2026 14:50 - Deletion in the middle removes the
+ *                                  link returned by FindInList directly
+ *          Sun 18 Oct 2026 15:30 - Added test for the list cursor
+ *          Sun 18 Oct 2026 21:45 - Added test for the parallel copy, the
+ *                                  lists are destroyed in the background
+ *          Mon 19 Oct 2026 02:30 - More than one file is loaded as shards
+ *                                  by a pool of threads and merged
+ *          Mon 19 Oct 2026 05:20 - Added test for the Bloom filter after
+ *                                  it grows
+ *          Mon 19 Oct 2026 05:35 - Added test for FindManyInList with
+ *                                  repeated and missing values
+ *          Mon 19 Oct 2026 05:50 - Added test for the set algebra on
+ *                                  overlapping, disjoint and empty lists
+ *          Mon 19 Oct 2026 06:05 - Added test for RemoveIfInList at the
+ *                                  head, the tail and on every element
+ *          Mon 19 Oct 2026 07:05 - Added test for ties when a cursor
+ *                                  looks in both directions
  *
  * @warning On any unrecoverable error, the program exits
  *
@@ -51,12 +73,357 @@
 #include <glib.h>  // Bring in glib for all doubly-linked list functions
 #include "FileIO.h"        // Used for the file access support functions
 #include "UserDefined.h"               // All the user defined functions
+#include "Stats.h"                   // Optional instrumentation counters
+#include "RecordStream.h"            // Streaming parser for the node file
+#include "AsyncLoader.h"               // Overlapped I/O and list building
+#include "ListAlgorithms.h"             // Top-k selection and set algebra
+#include "ListCursor.h"             // Remembers a position inside a list
+#include "AsyncList.h"           // Background destroy and parallel copy
+#include "ShardLoader.h"             // Parallel load of many node files
+#include "BloomFilter.h"             // Filter that rejects missing keys
 
 /** @def  NUMPARAMS
  * @brief This is the expected number of parameters from the command line.
  */
 #define NUMPARAMS 2
 
+/** @def  TEST_ITEMS
+ * @brief Number of items in the lists built by the checks below.
+ */
+#define TEST_ITEMS 256
+
+/** @def  FIND_VALUES
+ * @brief Number of values looked up at once by CheckFindMany().
+ */
+#define FIND_VALUES 40
+
+/*************************************************************************
+ *            Checks that build their own lists of test items            *
+ *************************************************************************/
+
+/* Name made of letters taken from an index, different for every index */
+static char * TestName (char *name, int index) {
+   int i = 4;
+
+   strcpy(name, "Duck");
+   do {
+      name[i++] = 'a' + index % 26;
+      index /= 26;
+   } while (index > 0);
+   name[i] = '\0';
+   return name;
+}
+
+/* New item whose name is made of letters taken from its index */
+static node_p TestItem (int number, int index) {
+   char name[16];
+
+   return NewItem(number, TestName(name, index));
+}
+
+/* Print the result of a check */
+static void CheckResult (const char *test, int errors) {
+   if (errors == 0)
+      printf("\n Test %s: passed\n", test);
+   else
+      printf("\nError: %s failed %d checks\n", test, errors);
+}
+
+/* Every inserted item is found after the filter grows past its size */
+static int CheckBloom (void) {
+   bloomList * bloom_p = NewBloomList(NULL, 0, 0.01);
+   GList     * l;
+   node_p      item_p;
+   size_t      capacity;
+   int         i, errors = 0;
+
+   if (bloom_p == NULL)
+      return 1;
+   capacity = bloom_p->capacity;
+   for (i = 0; i < TEST_ITEMS; i++)
+      BloomAppend(bloom_p, TestItem(i, i));      // Inserted even if it fails
+   errors += bloom_p->capacity <= capacity;               // It must grow
+   errors += g_list_length(bloom_p->list) != TEST_ITEMS;
+   for (l = bloom_p->list; l != NULL; l = l->next) {
+      item_p = l->data;
+      errors += BloomFind(bloom_p, &item_p->number, SINGLEINT) != l;
+      errors += BloomFind(bloom_p, item_p->theString, SINGLESTR) != l;
+   }
+   l = FreeBloomList(bloom_p);
+   DestroyList(l);
+   g_list_free(l);
+   return errors;
+}
+
+/* Many lookups at once give the same elements as one FindInList() each */
+static int CheckFindMany (void) {
+   GList      * theList_p = NULL;
+   GList      * found[FIND_VALUES];
+   char         names[FIND_VALUES][16];
+   const char * strings[FIND_VALUES];
+   int          numbers[FIND_VALUES];
+   int          i, count, expected, errors = 0;
+
+   // Numbers and names repeat along the list, so only the first counts
+   for (i = 0; i < TEST_ITEMS; i++)
+      theList_p = g_list_prepend(theList_p, TestItem(i % 50, i % 70));
+   theList_p = g_list_reverse(theList_p);
+
+   // Repeated values, and numbers from 50 and names from 70 are misses
+   for (i = 0; i < FIND_VALUES; i++) {
+      numbers[i] = (3 * i) % 60;
+      strings[i] = TestName(names[i], (5 * i) % 90);
+   }
+
+   count = FindManyInList(theList_p, numbers, FIND_VALUES, SINGLEINT,
+                          found);
+   for (i = expected = 0; i < FIND_VALUES; i++) {
+      errors += found[i] != FindInList(theList_p, &numbers[i], SINGLEINT);
+      expected += found[i] != NULL;
+   }
+   errors += count != expected || expected == 0 || expected == FIND_VALUES;
+
+   count = FindManyInList(theList_p, strings, FIND_VALUES, SINGLESTR,
+                          found);
+   for (i = expected = 0; i < FIND_VALUES; i++) {
+      errors += found[i] != FindInList(theList_p, strings[i], SINGLESTR);
+      expected += found[i] != NULL;
+   }
+   errors += count != expected || expected == 0 || expected == FIND_VALUES;
+
+   // Nothing is found in an empty list
+   count = FindManyInList(NULL, numbers, FIND_VALUES, SINGLEINT, found);
+   errors += count != 0;
+   for (i = 0; i < FIND_VALUES; i++)
+      errors += found[i] != NULL;
+
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+   return errors;
+}
+
+/* Set operation and which items of each number it keeps: the items of A
+ * paired with an item of B, those of A left unpaired, and so on */
+typedef struct setCase_ {
+   const char * name;
+   GList *   (* operation) (GList *, GList *, int);
+   int          pairedA, unpairedA, pairedB, unpairedB;
+} setCase;
+
+static const setCase setCases[] = {
+   {"MergeLists", MergeLists, TRUE, TRUE, TRUE, TRUE},
+   {"UnionLists", UnionLists, TRUE, TRUE, FALSE, TRUE},
+   {"IntersectLists", IntersectLists, TRUE, FALSE, FALSE, FALSE},
+   {"DifferenceLists", DifferenceLists, FALSE, TRUE, FALSE, FALSE}
+};
+
+/* Sorted list with an item for every number, named after first + i */
+static GList * TestList (const int *numbers, int count, int first) {
+   GList * theList_p = NULL;
+   int     i;
+
+   for (i = count - 1; i >= 0; i--)
+      theList_p = g_list_prepend(theList_p,
+                                 TestItem(numbers[i], first + i));
+   return theList_p;
+}
+
+/* Errors of a list against the numbers and name indexes it should have */
+static int SameItems (GList *theList_p, const int *numbers,
+                      const int *indexes, int count) {
+   GList  * l, * prev_p = NULL;
+   node_p   item_p;
+   char     name[16];
+   int      i = 0, errors = 0;
+
+   for (l = theList_p; l != NULL; prev_p = l, l = l->next, i++) {
+      errors += l->prev != prev_p;
+      if (i >= count)
+         continue;
+      item_p = l->data;
+      errors += item_p->number != numbers[i];
+      errors += strcmp(item_p->theString, TestName(name, indexes[i])) != 0;
+   }
+   return errors + (i != count);
+}
+
+/* Append the items from start to end of one of the lists */
+static int Expect (int *numbers, int *indexes, int count, const int *from,
+                   int start, int end, int first) {
+   for (; start < end; start++, count++) {
+      numbers[count] = from[start];
+      indexes[count] = first + start;
+   }
+   return count;
+}
+
+/* Build the result of a set operation number by number, pairing the items
+ * of A and B with the same number in order, and return its length */
+static int ExpectedSet (const setCase *case_p, const int *a, int countA,
+                        const int *b, int countB, int *numbers,
+                        int *indexes) {
+   int i = 0, j = 0, endA, endB, number, pairs, count = 0;
+
+   while (i < countA || j < countB) {
+      if (j == countB || (i < countA && a[i] <= b[j]))
+         number = a[i];
+      else
+         number = b[j];
+      for (endA = i; endA < countA && a[endA] == number; endA++);
+      for (endB = j; endB < countB && b[endB] == number; endB++);
+      pairs = MIN(endA - i, endB - j);
+
+      if (case_p->pairedA)
+         count = Expect(numbers, indexes, count, a, i, i + pairs, 0);
+      if (case_p->unpairedA)
+         count = Expect(numbers, indexes, count, a, i + pairs, endA, 0);
+      if (case_p->pairedB)
+         count = Expect(numbers, indexes, count, b, j, j + pairs,
+                        TEST_ITEMS);
+      if (case_p->unpairedB)
+         count = Expect(numbers, indexes, count, b, j + pairs, endB,
+                        TEST_ITEMS);
+      i = endA;
+      j = endB;
+   }
+   return count;
+}
+
+/* Every set operation, copying and consuming, on overlapping lists with
+ * repeated numbers, on disjoint lists and on empty lists */
+static int CheckSetAlgebra (void) {
+   static const int overlapA[] = {0, 0, 1, 2, 2, 2, 5, 7, 9, 9};
+   static const int overlapB[] = {0, 2, 2, 3, 5, 5, 8, 9};
+   static const int odd[] = {1, 3, 5, 7};
+   static const int even[] = {0, 2, 4, 6, 8};
+   static const struct {
+      const int * a;
+      int         countA;
+      const int * b;
+      int         countB;
+   } inputs[] = {
+      {overlapA, sizeof(overlapA) / sizeof(int),
+       overlapB, sizeof(overlapB) / sizeof(int)},
+      {odd, sizeof(odd) / sizeof(int), even, sizeof(even) / sizeof(int)},
+      {NULL, 0, overlapB, sizeof(overlapB) / sizeof(int)},
+      {overlapA, sizeof(overlapA) / sizeof(int), NULL, 0},
+      {NULL, 0, NULL, 0}
+   };
+   GList * a_p, * b_p, * result_p;
+   int     numbers[TEST_ITEMS], indexes[TEST_ITEMS];
+   int     orderA[TEST_ITEMS], orderB[TEST_ITEMS];
+   int     in, op, copy, i, count, failed, errors = 0;
+
+   for (i = 0; i < TEST_ITEMS; i++) {
+      orderA[i] = i;
+      orderB[i] = TEST_ITEMS + i;
+   }
+   for (in = 0; in < (int)(sizeof(inputs) / sizeof(inputs[0])); in++)
+      for (op = 0; op < (int)(sizeof(setCases) / sizeof(setCase)); op++)
+         for (copy = FALSE; copy <= TRUE; copy++) {
+            a_p = TestList(inputs[in].a, inputs[in].countA, 0);
+            b_p = TestList(inputs[in].b, inputs[in].countB, TEST_ITEMS);
+            count = ExpectedSet(&setCases[op], inputs[in].a,
+                                inputs[in].countA, inputs[in].b,
+                                inputs[in].countB, numbers, indexes);
+            result_p = setCases[op].operation(a_p, b_p, copy);
+            failed = SameItems(result_p, numbers, indexes, count);
+            if (copy) {                  // The lists must be left as they were
+               failed += SameItems(a_p, inputs[in].a, orderA,
+                                   inputs[in].countA);
+               failed += SameItems(b_p, inputs[in].b, orderB,
+                                   inputs[in].countB);
+               DestroyList(a_p);
+               g_list_free(a_p);
+               DestroyList(b_p);
+               g_list_free(b_p);
+            }
+            if (failed > 0)
+               printf("Error: %s with copy %d failed on lists %d\n",
+                      setCases[op].name, copy, in);
+            errors += failed;
+            DestroyList(result_p);
+            g_list_free(result_p);
+         }
+   return errors;
+}
+
+/* Predicate for RemoveIfInList(): EQUAL when the number of the item is a
+ * multiple of the value */
+static int IsMultiple (const void *item_p, const void *value_p, int key) {
+   return ((node_p)item_p)->number % *(const int *)value_p == 0 ?
+          EQUAL : NOTEQUAL;
+}
+
+/* Removing matching items at the head, the tail, inside and everywhere */
+static int CheckRemoveIf (void) {
+   static const int sixes[] = {6, 1, 6, 2, 6, 3, 6};
+   static const int left[] = {1, 2, 3}, leftIndexes[] = {1, 3, 5};
+   static const int odd[] = {1, 3, 5, 7, 9};
+   GList * theList_p;
+   int     numbers[11];
+   int     i, value, removed, errors = 0;
+
+   // Every six goes, with the default comparison
+   theList_p = TestList(sixes, 7, 0);
+   value = 6;
+   theList_p = RemoveIfInList(theList_p, NULL, &value, SINGLEINT, &removed);
+   errors += removed != 4;
+   errors += SameItems(theList_p, left, leftIndexes, 3);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+
+   // Even numbers from 0 to 10 go, the first and the last among them
+   for (i = 0; i < 11; i++)
+      numbers[i] = i;
+   theList_p = TestList(numbers, 11, 0);
+   value = 2;
+   theList_p = RemoveIfInList(theList_p, IsMultiple, &value, SINGLEINT,
+                              &removed);
+   errors += removed != 6;
+   errors += SameItems(theList_p, odd, odd, 5);
+
+   // Then all of them
+   value = 1;
+   theList_p = RemoveIfInList(theList_p, IsMultiple, &value, SINGLEINT,
+                              &removed);
+   errors += removed != 5 || theList_p != NULL;
+   return errors;
+}
+
+/* Position where CursorFindNear() stops, from a start, looking for 7 */
+static int NearSeven (const int *numbers, int count, long start) {
+   GList      * theList_p = TestList(numbers, count, 0);
+   listCursor * cursor_p = NewCursor(&theList_p);
+   char         name[16];
+   int          value = 7, position = -1;
+
+   if (cursor_p != NULL && CursorMove(cursor_p, start) == start &&
+       CursorFindNear(cursor_p, &value, SINGLEINT) == EXIT_SUCCESS)
+      for (position = 0; position < count; position++)
+         if (strcmp(CursorItem(cursor_p)->theString,
+                    TestName(name, position)) == 0)
+            break;
+   FreeCursor(cursor_p);
+   DestroyList(theList_p);
+   g_list_free(theList_p);
+   return position;
+}
+
+/* On a tie the element after the cursor wins, at any distance */
+static int CheckCursorTie (void) {
+   static const int one[] = {7, 1, 7};
+   static const int two[] = {7, 1, 2, 3, 7};
+   static const int here[] = {7, 7, 7};
+   static const int before[] = {7, 7, 1, 2, 3, 7};
+   int              errors = 0;
+
+   errors += NearSeven(one, 3, 1) != 2;
+   errors += NearSeven(two, 5, 2) != 4;
+   errors += NearSeven(here, 3, 1) != 1;
+   errors += NearSeven(before, 6, 2) != 1;         // Closer beats after
+   return errors;
+}
 
 /*************************************************************************
  *                           Main entry point                            *
@@ -66,7 +433,16 @@ int main (int argc, const char * argv[]) {          // Program entry point
    FILE   *fp;                                      // Pointer to the file
    GList * theList_p = NULL;           // Used to test the list operations
    GList * item_p = NULL;                    // Used in the find operation
+   GList * top_p = NULL;                      // Used in the top-k selection
+   GList * copy_p = NULL;                        // Used in the parallel copy
+   listCursor * cursor_p;                // Used for the clustered updates
    node_p  aNode_p;                       // Pointer to a node in the list
+   recordStream * stream_p;           // Streams the file without a list
+   recordView     record;                    // Record read from a stream
+   loadTimes      times;                 // Timings of the read-ahead load
+   loadTimes    * shardTimes_p;           // Timings of every shard loaded
+   GList        * link_p;               // Walks a list to check its order
+   long           records;                   // Counts the merged records
    int     nodeValue;         // Test integer for arbitrary integer search
 
     /* Check if the number of parameters is correct */
@@ -187,14 +563,14 @@ int main (int argc, const char * argv[]) {          // Program entry point
               printf("\nFound element in the list\n");
               PrintItem(aNode_p);
 
-              theList_p = g_list_remove(theList_p, aNode_p); // Remove node
+              // Remove the node and deallocate its data without searching
+              theList_p = RemoveFromList(theList_p, item_p);
 #ifdef DEBUG
               assert(theList_p != NULL);
 #else
               if (theList_p == NULL)
                  perror("Could not remove element from middle of the list");
 #endif
-              FreeItem(aNode_p);                        // Deallocate data
 
               printf("\n Test deletion from middle:\n");
               if (PrintList(theList_p) != EXIT_SUCCESS)
@@ -211,6 +587,25 @@ int main (int argc, const char * argv[]) {          // Program entry point
               PrintItem(item_p->data);
            }
 
+           /***** Test clustered updates with a cursor *****/
+           cursor_p = NewCursor(&theList_p);
+           if (cursor_p == NULL) {
+              perror("Could not create the cursor");
+           } else if (CursorFindNext(cursor_p, "Daisy", SINGLESTR)
+                      == EXIT_SUCCESS) {
+              CursorInsertAfter(cursor_p, NewItem(11, "Fethry"));
+              CursorInsertBefore(cursor_p, NewItem(12, "Gladstone"));
+              if (CursorFindNear(cursor_p, "Scroodge", SINGLESTR)
+                  == EXIT_SUCCESS)
+                 CursorRemove(cursor_p);        // Remove and deallocate
+
+              printf("\n Test updates around a cursor:\n");
+              if (PrintList(theList_p) != EXIT_SUCCESS)
+                 printf("Error printing the list\n");
+           }
+           FreeCursor(cursor_p);
+           CheckResult("cursor ties", CheckCursorTie());
+
            /***** Test copying the list *****/
            printf("\nCreating a copy of the list\n");
 
@@ -230,13 +625,98 @@ int main (int argc, const char * argv[]) {          // Program entry point
               PrintList(item_p);
            }
 
-            /***** Destroy the list *****/
-           if (DestroyList(theList_p) != EXIT_SUCCESS)
+           /***** Test selecting the largest numbers only *****/
+           top_p = TopKInList(theList_p, 3, GREATER, FALSE);
+           if (top_p == NULL){
+              printf("Error: failed to select the top of the list \n");
+           } else {
+              printf("Top 3 items\n");
+              PrintList(top_p);
+              g_list_free(top_p);            // The items are not copies
+           }
+
+           /***** Test the Bloom filter after it grows *****/
+           CheckResult("Bloom filter growth", CheckBloom());
+
+           /***** Test many lookups in a single pass *****/
+           CheckResult("FindManyInList", CheckFindMany());
+
+           /***** Test the set algebra on lists built for it *****/
+           CheckResult("set algebra", CheckSetAlgebra());
+
+           /***** Test removing every matching item in one pass *****/
+           CheckResult("RemoveIfInList", CheckRemoveIf());
+
+           /***** Test copying the list with several threads *****/
+           copy_p = CopyListParallel(theList_p, 0);
+           if (g_list_length(copy_p) != g_list_length(theList_p))
+              printf("Error: the parallel copy differs from the list\n");
+
+            /***** Destroy the lists in the background *****/
+           if (DestroyListAsync(theList_p) != EXIT_SUCCESS)
               perror("The list was not destroyed successfully");
 
-           if (DestroyList(item_p) != EXIT_SUCCESS)
+           if (DestroyListAsync(item_p) != EXIT_SUCCESS)
               perror("The second list was not destroyed successfullt");
-           
+
+           DestroyListAsync(copy_p);
+
+           /***** Test streaming the file without building a list *****/
+           rewind(fp);
+           stream_p = OpenRecordStream(fp);
+           if (stream_p == NULL) {
+              perror("Could not create the record stream");
+           } else {
+              if (StreamFind(stream_p, "Donald", SINGLESTR, &record)
+                  == EXIT_SUCCESS)
+                 printf("\nStreamed element: %d %s\n", record.number,
+                        record.theString);
+              nodeValue = 6;
+              printf("Records left with number %d: %ld\n", nodeValue,
+                     StreamCount(stream_p, &nodeValue, SINGLEINT));
+              CloseRecordStream(stream_p);
+           }
+
+           /***** Test loading the file with a reader thread *****/
+           item_p = LoadListAsync(argv[1], &times);
+           if (item_p == NULL) {
+              printf("Error: failed to load the list asynchronously\n");
+           } else {
+              printf("\nRead-ahead load:\n");
+              PrintLoadTimes(&times, stdout);
+              DestroyList(item_p);
+           }
+
+           /***** Test loading every file given as a shard *****/
+           if (argc > NUMPARAMS) {
+              shardTimes_p = malloc((argc - 1) * sizeof(loadTimes));
+              item_p = shardTimes_p == NULL ? NULL :
+                       LoadShards(&argv[1], argc - 1, 0, SHARD_MERGE,
+                                  shardTimes_p, &times);
+              if (item_p == NULL) {
+                 printf("Error: failed to load the shards\n");
+              } else {
+                 printf("\nSharded load:\n");
+                 PrintShardTimes(&argv[1], argc - 1, shardTimes_p, &times,
+                                 stdout);
+                 // The merged list must be sorted and hold every record
+                 for (link_p = item_p, records = 1; link_p->next != NULL;
+                      link_p = link_p->next, records++)
+                    if (CompareItems(link_p->data, link_p->next->data)
+                        == GREATER)
+                       printf("Error: the shards are not merged in order\n");
+                 if (records != times.records)
+                    printf("Error: %ld records merged, %ld loaded\n",
+                           records, times.records);
+                 DestroyList(item_p);
+              }
+              free(shardTimes_p);
+           }
+
+           StopReclaimer();           // Wait for the background frees
+#ifdef STATS
+           StatsDump(stderr);              // Report the hot-path counters
+#endif
         }
 
         fclose (fp);                        /* Close the input data file */